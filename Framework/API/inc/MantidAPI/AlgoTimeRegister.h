@@ -9,8 +9,14 @@
 #include "MantidKernel/Logger.h"
 #include "MantidKernel/SingletonHolder.h"
 #include "MantidKernel/Timer.h"
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <map>
 #include <mutex>
+#include <string>
 #include <thread>
+#include <utility>
 #include <vector>
 
 #include "MantidAPI/DllConfig.h"
@@ -18,6 +24,36 @@
 namespace Mantid {
 namespace Instrumentation {
 
+/** TraceSpan : a scoped region of code recorded in the Chrome trace written by
+ * AlgoTimeRegister.
+ *
+ * Spans opened on the same thread nest: each one records its depth and the
+ * name of the enclosing span. Counters (e.g. events processed or bytes read)
+ * can be attached to the span directly or, from code that does not own it, to
+ * the innermost open span of the calling thread with addToCurrent. The peak
+ * resident memory of the process is recorded when the span closes. When
+ * tracing is disabled constructing a span only reads an atomic flag.
+ */
+class MANTID_API_DLL TraceSpan {
+public:
+  TraceSpan(std::string name, std::string category = "function");
+  ~TraceSpan();
+  TraceSpan(const TraceSpan &) = delete;
+  TraceSpan &operator=(const TraceSpan &) = delete;
+
+  void addCounter(const std::string &name, const int64_t value);
+  static void addToCurrent(const std::string &name, const int64_t value);
+
+private:
+  const std::string m_name;
+  const std::string m_category;
+  const bool m_enabled;
+  size_t m_depth{0};
+  const TraceSpan *m_parent{nullptr};
+  Kernel::time_point_ns m_start;
+  std::vector<std::pair<std::string, int64_t>> m_counters;
+};
+
 /** AlgoTimeRegister : simple class to dump information about executed
  * algorithms
  */
@@ -29,6 +65,7 @@ public:
   class Dump {
     Kernel::time_point_ns m_regStart_chrono;
     const std::string m_name;
+    TraceSpan m_span;
 
   public:
     Dump(const std::string &nm);
@@ -39,6 +76,13 @@ public:
                const Kernel::time_point_ns &end);
   void addTime(const std::string &name, const Kernel::time_point_ns &begin, const Kernel::time_point_ns &end);
 
+  void updateTraceSettings();
+  /// True if spans are being recorded to the Chrome trace file
+  bool traceEnabled() const { return m_traceEnabled.load(std::memory_order_relaxed); }
+  void addSpan(const std::string &name, const std::string &category, const std::thread::id thread_id,
+               const Kernel::time_point_ns &begin, const Kernel::time_point_ns &end, const size_t depth,
+               const std::string &parent, const std::vector<std::pair<std::string, int64_t>> &counters);
+
   std::mutex m_mutex;
 
 private:
@@ -48,10 +92,22 @@ private:
   ~AlgoTimeRegisterImpl();
 
   bool writeToFile();
+  bool openTraceFile();
+  void closeTraceFile();
 
   Kernel::time_point_ns m_start;
   std::string m_filename;
   bool m_hasWrittenToFile;
+
+  std::atomic<bool> m_traceEnabled;
+  /// The trace file requested by the configuration
+  std::string m_traceFilename;
+  /// The trace file currently open in m_traceStream
+  std::string m_traceOpenFilename;
+  std::ofstream m_traceStream;
+  size_t m_traceEventCount;
+  /// Small sequential thread numbers, as expected by trace viewers
+  std::map<std::thread::id, int> m_traceThreadIds;
 };
 
 using AlgoTimeRegister = Mantid::Kernel::SingletonHolder<AlgoTimeRegisterImpl>;
@@ -406,9 +406,9 @@ protected:
   /// Set if an exception is thrown, and not caught, within a parallel region
   std::atomic<bool> m_parallelException;
 
-  friend class WorkspaceHistory; // Allow workspace history loading to adjust
-                                 // g_execCount
-  static size_t g_execCount;     ///< Counter to keep track of algorithm execution order
+  friend class WorkspaceHistory;          // Allow workspace history loading to adjust
+                                          // g_execCount
+  static std::atomic<size_t> g_execCount; ///< Counter to keep track of algorithm execution order
 
   virtual void setOtherProperties(IAlgorithm *alg, const std::string &propertyName, const std::string &propertyValue,
                                   int periodNum);
@@ -456,6 +456,8 @@ private:
 
   void logAlgorithmInfo() const;
 
+  void addWorkspaceSizesToTrace() const;
+
   bool executeInternal();
 
   bool executeAsyncImpl(const Poco::Void &i);
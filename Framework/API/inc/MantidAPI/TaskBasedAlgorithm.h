@@ -6,8 +6,13 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #pragma once
 #include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
 #include <limits>
+#include <mutex>
 #include <numeric>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
@@ -19,11 +24,13 @@
 #include "MantidAPI/DataProcessorAlgorithm.h"
 #include "MatrixWorkspace.h"
 
+#include "tbb/task_group.h"
+
 namespace Mantid::API {
 
 template <class T> class TaskBasedAlgorithm : virtual public API::DataProcessorAlgorithm {
 public:
-  TaskBasedAlgorithm() : m_mutableInput(false) {}
+  TaskBasedAlgorithm() : m_mutableInput(false), m_concurrentTasks(false) {}
 
 protected:
   class AlgorithmTask {
@@ -51,7 +58,11 @@ protected:
       }
     }
     void execute() {
-      auto missingTasks = evaluateDependentTasks();
+      std::vector<std::string> missingTasks;
+      {
+        std::lock_guard<std::mutex> lock(m_parent->m_algorithmTaskOutputsMutex);
+        missingTasks = evaluateDependentTasks();
+      }
       if (!missingTasks.empty()) {
         throw std::runtime_error(
             "Cannot execute task " + m_name + " as the following dependent tasks outputs are not available: " +
@@ -75,12 +86,59 @@ protected:
       m_taskExecutionOrder = taskExecutionOrder;
     }
     const std::string &getSelectedOutput() const { return m_selectedOutput; }
-    void clear() { m_fulfilledDependantTaskSets.clear(); }
+    void clear() {
+      m_fulfilledDependantTaskSets.clear();
+      m_requiredDependantTaskSet.reset();
+    }
+
+    // Select the dependant task set this task would use if the staged tasks ran one after another in the task
+    // execution order, and return the names of the tasks in it. This task must wait for those tasks when the
+    // staged tasks run concurrently. Returns nothing if no set can be fulfilled, which execute() reports.
+    std::vector<std::string> resolveDependantTasks() {
+      m_requiredDependantTaskSet.reset();
+      if (m_firstTaskFlag)
+        return {};
+      const auto indexOf = [this](const std::string &taskName) {
+        return std::distance(m_taskExecutionOrder->cbegin(),
+                             std::find(m_taskExecutionOrder->cbegin(), m_taskExecutionOrder->cend(), taskName));
+      };
+      const auto myIndex = indexOf(m_name);
+      // A set is fulfilled if all of its tasks are staged before this one
+      std::vector<size_t> fulfilledTaskSets;
+      for (size_t i = 0; i < m_dependantTasks.size(); ++i) {
+        if (std::all_of(m_dependantTasks[i].cbegin(), m_dependantTasks[i].cend(),
+                        [&](const auto &task) { return indexOf(task.first) < myIndex; }))
+          fulfilledTaskSets.emplace_back(i);
+      }
+      if (fulfilledTaskSets.empty())
+        return {};
+      // The same choice as activateTaskSet: the set containing the closest preceding task
+      size_t selectedTaskSet = fulfilledTaskSets.front();
+      if (fulfilledTaskSets.size() > 1) {
+        selectedTaskSet = 0;
+        auto closestDistance = std::numeric_limits<decltype(myIndex)>::max();
+        for (const auto taskSet : fulfilledTaskSets) {
+          for (const auto &task : m_dependantTasks[taskSet]) {
+            const auto distance = myIndex - indexOf(task.first);
+            if (distance < closestDistance && distance > 0) {
+              closestDistance = distance;
+              selectedTaskSet = taskSet;
+            }
+          }
+        }
+      }
+      m_requiredDependantTaskSet = selectedTaskSet;
+      std::vector<std::string> taskNames;
+      std::transform(m_dependantTasks[selectedTaskSet].cbegin(), m_dependantTasks[selectedTaskSet].cend(),
+                     std::back_inserter(taskNames), [](const auto &task) { return task.first; });
+      return taskNames;
+    }
 
   protected:
     T *m_parent;
     void outputWorkspace(std::shared_ptr<MatrixWorkspace> ws, const std::string &outputName) {
       setSelectedOutput(outputName);
+      std::lock_guard<std::mutex> lock(m_parent->m_algorithmTaskOutputsMutex);
       m_parent->m_algorithmTaskOutputs[m_name][outputName] = std::move(ws);
     }
 
@@ -106,6 +164,8 @@ protected:
     std::vector<size_t> m_fulfilledDependantTaskSets;
     const std::vector<std::string> *m_taskExecutionOrder = nullptr;
     std::string m_selectedOutput;
+    // set chosen by resolveDependantTasks, which must be used when tasks run concurrently
+    std::optional<size_t> m_requiredDependantTaskSet;
 
     virtual void executeImpl() = 0;
 
@@ -130,6 +190,14 @@ protected:
     }
 
     void activateTaskSet() {
+      // When tasks run concurrently, outputs of tasks later in the execution order may already be available, so use
+      // the set selected up front rather than whatever is fulfilled at this moment
+      if (m_requiredDependantTaskSet &&
+          std::find(m_fulfilledDependantTaskSets.cbegin(), m_fulfilledDependantTaskSets.cend(),
+                    *m_requiredDependantTaskSet) != m_fulfilledDependantTaskSets.cend()) {
+        m_activeDependantTaskSet = *m_requiredDependantTaskSet;
+        return;
+      }
       if (m_fulfilledDependantTaskSets.size() == 1) {
         m_activeDependantTaskSet = m_fulfilledDependantTaskSets.front();
         return;
@@ -160,6 +228,7 @@ protected:
 
     // after execution, check that expected outputs from this task are present in m_algorithmTaskOutputs
     void checkExpectedOutputs() {
+      std::lock_guard<std::mutex> lock(m_parent->m_algorithmTaskOutputsMutex);
       if (!m_parent->m_algorithmTaskOutputs.contains(m_name))
         throw std::runtime_error("No output from task " + m_name + " found after task execution");
       std::vector<std::string> missingOutput;
@@ -275,21 +344,17 @@ protected:
     configureAlgorithmTasks();
 
     try {
-      int step = 0;
-      for (size_t i = 0; i < m_stagedAlgorithmTasks.size(); ++i) {
-        const auto &task = m_stagedAlgorithmTasks[i];
-        task->execute();
-        if (!diagWorkspacePrefix.empty()) {
-          const auto &taskOutput = m_algorithmTaskOutputs.at(task->name());
-          for (const auto &output : taskOutput) {
-            const auto &outputName = output.first;
-            outputDebugWorkspace(output.second, diagWorkspacePrefix, "_" + outputName, step);
-          }
-          step++;
+      if (m_concurrentTasks) {
+        execTasksConcurrently(diagWorkspacePrefix);
+      } else {
+        for (size_t i = 0; i < m_stagedAlgorithmTasks.size(); ++i) {
+          executeStagedTask(i, diagWorkspacePrefix);
         }
-        // Output the selected output of the last task
-        if (i == m_stagedAlgorithmTasks.size() - 1)
-          setProperty("OutputWorkspace", m_algorithmTaskOutputs.at(task->name()).at(task->getSelectedOutput()));
+      }
+      // Output the selected output of the last task
+      if (!m_stagedAlgorithmTasks.empty()) {
+        const auto &lastTask = m_stagedAlgorithmTasks.back();
+        setProperty("OutputWorkspace", m_algorithmTaskOutputs.at(lastTask->name()).at(lastTask->getSelectedOutput()));
       }
       clearMembers();
     } catch (...) { // ensure members are cleared even if error is throw during execution
@@ -298,6 +363,66 @@ protected:
     }
   }
 
+  void executeStagedTask(const size_t index, const std::string &diagWorkspacePrefix) {
+    const auto &task = m_stagedAlgorithmTasks[index];
+    task->execute();
+    if (!diagWorkspacePrefix.empty()) {
+      std::lock_guard<std::mutex> lock(m_algorithmTaskOutputsMutex);
+      const auto &taskOutput = m_algorithmTaskOutputs.at(task->name());
+      for (const auto &output : taskOutput) {
+        const auto &outputName = output.first;
+        outputDebugWorkspace(output.second, diagWorkspacePrefix, "_" + outputName, static_cast<int>(index));
+      }
+    }
+  }
+
+  // Run each staged task as soon as the tasks it depends on have finished, so that independent branches of the
+  // workflow run at the same time on the shared TBB thread pool. The dependencies are the ones each task would use
+  // if the tasks ran in sequence, so the result is the same as for a sequential run.
+  void execTasksConcurrently(const std::string &diagWorkspacePrefix) {
+    const auto numTasks = m_stagedAlgorithmTasks.size();
+    std::vector<std::vector<size_t>> dependantTasks(numTasks);
+    std::vector<std::atomic<size_t>> unfinishedDependencies(numTasks);
+    for (size_t i = 0; i < numTasks; ++i) {
+      const auto dependencies = m_stagedAlgorithmTasks[i]->resolveDependantTasks();
+      for (const auto &dependency : dependencies) {
+        const auto it = std::find(m_taskExecutionOrder.cbegin(), m_taskExecutionOrder.cend(), dependency);
+        dependantTasks[std::distance(m_taskExecutionOrder.cbegin(), it)].emplace_back(i);
+      }
+      unfinishedDependencies[i] = dependencies.size();
+    }
+
+    tbb::task_group taskGroup;
+    std::mutex errorMutex;
+    std::exception_ptr firstError;
+    std::atomic<bool> failed{false};
+    std::function<void(size_t)> runTask = [&](const size_t index) {
+      if (failed || m_cancel)
+        return;
+      try {
+        executeStagedTask(index, diagWorkspacePrefix);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(errorMutex);
+        if (!firstError)
+          firstError = std::current_exception();
+        failed = true;
+        return;
+      }
+      for (const auto dependant : dependantTasks[index]) {
+        if (--unfinishedDependencies[dependant] == 0)
+          taskGroup.run([&runTask, dependant] { runTask(dependant); });
+      }
+    };
+    for (size_t i = 0; i < numTasks; ++i) {
+      if (unfinishedDependencies[i] == 0)
+        taskGroup.run([&runTask, i] { runTask(i); });
+    }
+    taskGroup.wait();
+    if (firstError)
+      std::rethrow_exception(firstError);
+    interruption_point();
+  }
+
   void clearMembers() {
     for (auto &task : m_stagedAlgorithmTasks) {
       task->clear();
@@ -332,12 +457,19 @@ protected:
   // Allows the tasks to mutate the original input workspace
   void setMutableInput(const bool inputIsMutable) { m_mutableInput = inputIsMutable; }
 
+  // Run tasks whose dependencies have been met concurrently. Only enable this if no task modifies the workspaces it
+  // gets from getDependantWorkspace in place, as another task may be reading them at the same time.
+  void setConcurrentTaskExecution(const bool concurrent) { m_concurrentTasks = concurrent; }
+
   std::vector<std::shared_ptr<AlgorithmTask>> m_stagedAlgorithmTasks;
   // map of task name: (map of output name: outputs)
   std::unordered_map<std::string, std::unordered_map<std::string, std::shared_ptr<MatrixWorkspace>>>
       m_algorithmTaskOutputs;
+  // guards m_algorithmTaskOutputs when tasks run concurrently
+  std::mutex m_algorithmTaskOutputsMutex;
   std::vector<std::shared_ptr<AlgorithmTask>> m_AlgorithmTasks;
   std::vector<std::string> m_taskExecutionOrder;
   bool m_mutableInput;
+  bool m_concurrentTasks;
 };
 } // namespace Mantid::API
@@ -6,8 +6,14 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidAPI/AlgoTimeRegister.h"
 #include "MantidKernel/ConfigService.h"
+#include "MantidKernel/Memory.h"
 #include "MantidKernel/MultiThreaded.h"
-#include <fstream>
+
+#include <Poco/Process.h>
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
 #include <time.h>
 
 namespace Mantid {
@@ -18,13 +24,110 @@ Kernel::Logger &LOGGER() {
   static Kernel::Logger logger("AlgoTimeRegister");
   return logger;
 }
+
+/// The spans currently open on this thread, innermost last
+std::vector<TraceSpan *> &openSpans() {
+  thread_local std::vector<TraceSpan *> spans;
+  return spans;
+}
+
+/// Peak resident memory of the process in kiB
+size_t peakRSSInKiB() {
+  static const Kernel::MemoryStats memoryStats(Kernel::MEMORY_STATS_IGNORE_SYSTEM);
+  return memoryStats.getPeakRSS() / 1024;
+}
+
+/// Write a string as a JSON string literal
+void writeJSONString(std::ostream &os, const std::string &value) {
+  os << '"';
+  for (const char c : value) {
+    switch (c) {
+    case '"':
+      os << "\\\"";
+      break;
+    case '\\':
+      os << "\\\\";
+      break;
+    case '\n':
+      os << "\\n";
+      break;
+    case '\t':
+      os << "\\t";
+      break;
+    default:
+      if (static_cast<unsigned char>(c) < 0x20)
+        os << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+      else
+        os << c;
+    }
+  }
+  os << '"';
+}
 } // namespace
 
 using Kernel::ConfigService;
 using Kernel::time_point_ns;
 
+//---------------------------------------------------------------------------------------------
+/** Open a span on the calling thread. Nothing is recorded unless tracing is
+ * enabled, see AlgoTimeRegisterImpl::updateTraceSettings.
+ * @param name :: The name shown for the span in the trace viewer
+ * @param category :: The category of the span, e.g. "algorithm" or "phase"
+ */
+TraceSpan::TraceSpan(std::string name, std::string category)
+    : m_name(std::move(name)), m_category(std::move(category)),
+      m_enabled(AlgoTimeRegister::Instance().traceEnabled()) {
+  if (!m_enabled)
+    return;
+  auto &spans = openSpans();
+  m_depth = spans.size();
+  m_parent = spans.empty() ? nullptr : spans.back();
+  spans.emplace_back(this);
+  m_start = std::chrono::high_resolution_clock::now();
+}
+
+TraceSpan::~TraceSpan() {
+  if (!m_enabled)
+    return;
+  const Kernel::time_point_ns end = std::chrono::high_resolution_clock::now();
+  // Spans are scoped objects, so this is the innermost span open on this thread
+  auto &spans = openSpans();
+  if (!spans.empty() && spans.back() == this)
+    spans.pop_back();
+  m_counters.emplace_back("peak_rss_kb", static_cast<int64_t>(peakRSSInKiB()));
+  AlgoTimeRegister::Instance().addSpan(m_name, m_category, std::this_thread::get_id(), m_start, end, m_depth,
+                                       m_parent ? m_parent->m_name : "", m_counters);
+}
+
+/** Add to a counter of this span, creating it if needed
+ * @param name :: The name of the counter, e.g. "events"
+ * @param value :: The amount to add
+ */
+void TraceSpan::addCounter(const std::string &name, const int64_t value) {
+  if (!m_enabled)
+    return;
+  auto counter = std::find_if(m_counters.begin(), m_counters.end(),
+                              [&name](const auto &nameAndValue) { return nameAndValue.first == name; });
+  if (counter == m_counters.end())
+    m_counters.emplace_back(name, value);
+  else
+    counter->second += value;
+}
+
+/** Add to a counter of the innermost span open on the calling thread. This
+ * does nothing if there is no open span.
+ * @param name :: The name of the counter, e.g. "events"
+ * @param value :: The amount to add
+ */
+void TraceSpan::addToCurrent(const std::string &name, const int64_t value) {
+  auto &spans = openSpans();
+  if (!spans.empty())
+    spans.back()->addCounter(name, value);
+}
+
+//---------------------------------------------------------------------------------------------
 AlgoTimeRegisterImpl::Dump::Dump(const std::string &nm)
-    : m_regStart_chrono(std::chrono::high_resolution_clock::now()), m_name(nm) {}
+    : m_regStart_chrono(std::chrono::high_resolution_clock::now()), m_name(nm), m_span(nm, "algorithm") {}
 
 AlgoTimeRegisterImpl::Dump::~Dump() {
   const time_point_ns regFinish = std::chrono::high_resolution_clock::now();
@@ -89,10 +192,106 @@ void AlgoTimeRegisterImpl::addTime(const std::string &name, const std::thread::i
   }
 }
 
+/** Re-read the tracing configuration. Spans are recorded in the Chrome trace
+ * event format if performancelog.write is enabled and
+ * performancelog.tracefilename is not empty. This is called each time an
+ * algorithm is executed so that spans opened in between can cheaply check the
+ * cached value.
+ */
+void AlgoTimeRegisterImpl::updateTraceSettings() {
+  const auto &config = Kernel::ConfigService::Instance();
+  const bool writeEnable = config.getValue<bool>("performancelog.write").value_or(false);
+  const auto filename = config.getString("performancelog.tracefilename");
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_traceFilename = filename;
+  m_traceEnabled.store(writeEnable && !filename.empty(), std::memory_order_relaxed);
+}
+
+/** Make sure the configured trace file is open, starting a new trace if the
+ * configured filename has changed. Must be called with m_mutex held.
+ * @return true if the trace file can be written to
+ */
+bool AlgoTimeRegisterImpl::openTraceFile() {
+  if (m_traceStream.is_open() && m_traceOpenFilename == m_traceFilename)
+    return true;
+  closeTraceFile();
+  m_traceStream.open(m_traceFilename, std::ios::out | std::ios::trunc);
+  if (!m_traceStream.is_open()) {
+    LOGGER().notice() << "Failed to open the trace file " << m_traceFilename << ", spans will not be written.\n";
+    m_traceEnabled.store(false, std::memory_order_relaxed);
+    return false;
+  }
+  LOGGER().debug() << "Performance trace file: " << m_traceFilename << '\n';
+  m_traceOpenFilename = m_traceFilename;
+  m_traceEventCount = 0;
+  // The JSON array format: trace viewers accept a file whose closing bracket
+  // is missing, so the trace stays usable if the process does not exit cleanly
+  m_traceStream << "[\n";
+  return true;
+}
+
+/// Terminate the JSON array of the open trace file and close it
+void AlgoTimeRegisterImpl::closeTraceFile() {
+  if (!m_traceStream.is_open())
+    return;
+  m_traceStream << "\n]\n";
+  m_traceStream.close();
+  m_traceOpenFilename.clear();
+}
+
+/** Append a complete ("X") event to the Chrome trace file. Times are written in
+ * microseconds since the register was created.
+ * @param name :: The name of the span
+ * @param category :: The category of the span
+ * @param thread_id :: The thread the span ran on
+ * @param begin :: When the span was opened
+ * @param end :: When the span was closed
+ * @param depth :: The number of spans enclosing this one on its thread
+ * @param parent :: The name of the enclosing span, empty at depth 0
+ * @param counters :: Named counters, written to the event arguments
+ */
+void AlgoTimeRegisterImpl::addSpan(const std::string &name, const std::string &category,
+                                   const std::thread::id thread_id, const Kernel::time_point_ns &begin,
+                                   const Kernel::time_point_ns &end, const size_t depth, const std::string &parent,
+                                   const std::vector<std::pair<std::string, int64_t>> &counters) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (!m_traceEnabled.load(std::memory_order_relaxed) || !openTraceFile())
+    return;
+  const auto threadNumber = m_traceThreadIds.emplace(thread_id, static_cast<int>(m_traceThreadIds.size())).first;
+  const std::chrono::nanoseconds start = begin - m_start;
+  const std::chrono::nanoseconds duration = end - begin;
+
+  std::ostringstream event;
+  event << std::fixed << std::setprecision(3);
+  event << "{\"name\":";
+  writeJSONString(event, name);
+  event << ",\"cat\":";
+  writeJSONString(event, category);
+  event << ",\"ph\":\"X\",\"ts\":" << static_cast<double>(start.count()) / 1000.
+        << ",\"dur\":" << static_cast<double>(duration.count()) / 1000. << ",\"pid\":" << Poco::Process::id()
+        << ",\"tid\":" << threadNumber->second << ",\"args\":{\"depth\":" << depth << ",\"parent\":";
+  writeJSONString(event, parent);
+  for (const auto &counter : counters) {
+    event << ',';
+    writeJSONString(event, counter.first);
+    event << ':' << counter.second;
+  }
+  event << "}}";
+
+  if (m_traceEventCount++ > 0)
+    m_traceStream << ",\n";
+  m_traceStream << event.str();
+  // Flushing once per outermost span keeps the file current without paying
+  // for a flush in every nested span
+  if (depth == 0)
+    m_traceStream.flush();
+}
+
 AlgoTimeRegisterImpl::AlgoTimeRegisterImpl()
-    : m_start(std::chrono::high_resolution_clock::now()), m_hasWrittenToFile(false) {}
+    : m_start(std::chrono::high_resolution_clock::now()), m_hasWrittenToFile(false), m_traceEnabled(false),
+      m_traceEventCount(0) {}
 
-AlgoTimeRegisterImpl::~AlgoTimeRegisterImpl() {}
+AlgoTimeRegisterImpl::~AlgoTimeRegisterImpl() { closeTraceFile(); }
 
 } // namespace Instrumentation
 } // namespace Mantid
@@ -6,6 +6,7 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidAPI/Algorithm.h"
 #include "MantidAPI/ADSValidator.h"
+#include "MantidAPI/AlgoTimeRegister.h"
 #include "MantidAPI/AlgorithmHistory.h"
 #include "MantidAPI/AlgorithmManager.h"
 #include "MantidAPI/AnalysisDataService.h"
@@ -38,9 +39,11 @@
 #include <json/json.h>
 
 #include <algorithm>
+#include <functional>
 #include <iterator>
 #include <map>
 #include <memory>
+#include <optional>
 #include <utility>
 
 // Index property handling template definitions
@@ -72,6 +75,14 @@ private:
   const std::string &m_value;
 };
 
+/// The algorithms.history.policy value that stops child algorithm histories being recorded
+const std::string TOP_LEVEL_ONLY_HISTORY("TopLevelOnly");
+
+/// Return false if the configured history policy only records top-level algorithms
+bool childHistoryAllowedByPolicy() {
+  return ConfigService::Instance().getString("algorithms.history.policy") != TOP_LEVEL_ONLY_HISTORY;
+}
+
 template <typename T> struct RunOnFinish {
   RunOnFinish(T &&task) : m_onfinsh(std::move(task)) {}
   ~RunOnFinish() { m_onfinsh(); }
@@ -106,7 +117,7 @@ template MANTID_API_DLL bool Algorithm::isEmpty<std::size_t>(const std::size_t);
 //=============================================================================================
 
 /// Initialize static algorithm counter
-size_t Algorithm::g_execCount = 0;
+std::atomic<size_t> Algorithm::g_execCount{0};
 
 /// Constructor
 Algorithm::Algorithm()
@@ -171,10 +182,14 @@ void Algorithm::setChild(const bool isChild) {
 
 /**
  * Change the state of the history recording flag. Only applicable for
- * child algorithms.
+ * child algorithms. The flag cannot be turned on if the
+ * algorithms.history.policy setting is TopLevelOnly, which avoids building the
+ * histories of every child algorithm call in deeply nested workflows.
  * @param on :: The new state of the flag
  */
-void Algorithm::enableHistoryRecordingForChild(const bool on) { m_recordHistoryForChild = on; }
+void Algorithm::enableHistoryRecordingForChild(const bool on) {
+  m_recordHistoryForChild = on && childHistoryAllowedByPolicy();
+}
 
 /** Change the state of the processGroups history recording flag.
  * @param on :: The new state of the flag
@@ -445,38 +460,52 @@ void Algorithm::lockWorkspaces() {
     throw std::logic_error("Algorithm::lockWorkspaces(): The workspaces have "
                            "already been locked!");
 
-  // First, Write-lock the output workspaces
-  auto &debugLog = g_log.debug();
+  // Collect the workspaces whose properties say to do locking. A workspace that
+  // is both an input and an output is only write-locked, and each workspace is
+  // only locked once.
+  std::vector<Workspace_sptr> toWriteLock, toReadLock;
+  const auto contains = [](const std::vector<Workspace_sptr> &workspaces, const Workspace_sptr &ws) {
+    return std::find(workspaces.cbegin(), workspaces.cend(), ws) != workspaces.cend();
+  };
   for (auto &outputWorkspaceProp : m_outputWorkspaceProps) {
     Workspace_sptr ws = outputWorkspaceProp->getWorkspace();
-    if (ws) {
-      // The workspace property says to do locking,
-      // AND it has NOT already been write-locked
-      if (outputWorkspaceProp->isLocking() && std::find(m_writeLockedWorkspaces.begin(), m_writeLockedWorkspaces.end(),
-                                                        ws) == m_writeLockedWorkspaces.end()) {
-        // Write-lock it if not already
-        debugLog << "Write-locking " << ws->getName() << '\n';
-        ws->getLock()->writeLock();
-        m_writeLockedWorkspaces.emplace_back(ws);
-      }
-    }
+    if (ws && outputWorkspaceProp->isLocking() && !contains(toWriteLock, ws))
+      toWriteLock.emplace_back(std::move(ws));
   }
-
-  // Next read-lock the input workspaces
   for (auto &inputWorkspaceProp : m_inputWorkspaceProps) {
     Workspace_sptr ws = inputWorkspaceProp->getWorkspace();
-    if (ws) {
-      // The workspace property says to do locking,
-      // AND it has NOT already been write-locked
-      if (inputWorkspaceProp->isLocking() && std::find(m_writeLockedWorkspaces.begin(), m_writeLockedWorkspaces.end(),
-                                                       ws) == m_writeLockedWorkspaces.end()) {
-        // Read-lock it if not already write-locked
-        debugLog << "Read-locking " << ws->getName() << '\n';
-        ws->getLock()->readLock();
-        m_readLockedWorkspaces.emplace_back(ws);
-      }
+    if (ws && inputWorkspaceProp->isLocking() && !contains(toWriteLock, ws) && !contains(toReadLock, ws))
+      toReadLock.emplace_back(std::move(ws));
+  }
+
+  // Take the locks in order of address. Algorithms running concurrently then
+  // always acquire shared workspaces in the same order, so one reading A and
+  // writing B cannot deadlock against another reading B and writing A.
+  std::vector<std::pair<Workspace *, bool>> locks;
+  locks.reserve(toWriteLock.size() + toReadLock.size());
+  for (const auto &ws : toWriteLock)
+    locks.emplace_back(ws.get(), true);
+  for (const auto &ws : toReadLock)
+    locks.emplace_back(ws.get(), false);
+  std::sort(locks.begin(), locks.end(),
+            [](const auto &lhs, const auto &rhs) { return std::less<const Workspace *>()(lhs.first, rhs.first); });
+
+  auto &debugLog = g_log.debug();
+  for (const auto &[ws, write] : locks) {
+    auto *lock = ws->getLock();
+    // Only report contention: an uncontended lock is taken without waiting
+    if (!(write ? lock->tryWriteLock() : lock->tryReadLock())) {
+      g_log.information() << "Waiting for the " << (write ? "write" : "read") << " lock on " << ws->getName()
+                          << '\n';
+      if (write)
+        lock->writeLock();
+      else
+        lock->readLock();
     }
+    debugLog << (write ? "Write-locked " : "Read-locked ") << ws->getName() << '\n';
   }
+  m_writeLockedWorkspaces = std::move(toWriteLock);
+  m_readLockedWorkspaces = std::move(toReadLock);
 }
 
 //---------------------------------------------------------------------------------------------
@@ -519,6 +548,23 @@ void Algorithm::clearWorkspaceCaches() {
   m_unrolledInputWorkspaces.clear();
 }
 
+//---------------------------------------------------------------------------------------------
+/** Record the total memory of the input and output workspaces as counters of
+ * the trace span that is open for this algorithm.
+ */
+void Algorithm::addWorkspaceSizesToTrace() const {
+  const auto totalMemory = [](const std::vector<IWorkspaceProperty *> &props) {
+    int64_t bytes{0};
+    for (const auto *prop : props) {
+      if (const auto ws = prop->getWorkspace())
+        bytes += static_cast<int64_t>(ws->getMemorySize());
+    }
+    return bytes;
+  };
+  Instrumentation::TraceSpan::addToCurrent("input_bytes", totalMemory(m_inputWorkspaceProps));
+  Instrumentation::TraceSpan::addToCurrent("output_bytes", totalMemory(m_outputWorkspaceProps));
+}
+
 //---------------------------------------------------------------------------------------------
 /** Invoced internally in execute()
  */
@@ -562,6 +608,8 @@ bool Algorithm::executeInternal() {
   // Check all properties for validity
   constexpr bool resetTimer{true};
   float timingInit = timer.elapsed(resetTimer);
+  std::optional<Instrumentation::TraceSpan> phaseSpan;
+  phaseSpan.emplace("validateProperties", "phase");
   if (!validateProperties()) {
     // Reset name on input workspaces to trigger attempt at collection from ADS
     const auto &props = getProperties();
@@ -578,6 +626,7 @@ bool Algorithm::executeInternal() {
       throw std::runtime_error("Some invalid Properties found");
     }
   }
+  phaseSpan.reset();
   const float timingPropertyValidation = timer.elapsed(resetTimer);
 
   // All properties are now valid - cache workspace properties and histories
@@ -606,6 +655,7 @@ bool Algorithm::executeInternal() {
   // ----- Perform validation of the whole set of properties -------------
   if ((!callProcessGroups)) // for groups this is called on each workspace separately
   {
+    phaseSpan.emplace("validateInputs", "phase");
     std::map<std::string, std::string> errors = this->validateInputs();
     if (!errors.empty()) {
       size_t numErrors = errors.size();
@@ -632,6 +682,7 @@ bool Algorithm::executeInternal() {
       }
     }
   }
+  phaseSpan.reset();
   const float timingInputValidation = timer.elapsed(resetTimer);
 
   if (trackingHistory()) {
@@ -655,7 +706,9 @@ bool Algorithm::executeInternal() {
   }
 
   // Read or write locks every input/output workspace
+  phaseSpan.emplace("lockWorkspaces", "phase");
   this->lockWorkspaces();
+  phaseSpan.reset();
   timingInit += timer.elapsed(resetTimer);
 
   // Invoke exec() method of derived class and catch all uncaught exceptions
@@ -665,16 +718,21 @@ bool Algorithm::executeInternal() {
 
       startTime = Mantid::Types::Core::DateAndTime::getCurrentTime();
       // Call the concrete algorithm's exec method
+      phaseSpan.emplace("exec", "phase");
       this->exec();
       registerFeatureUsage();
       // Check for a cancellation request in case the concrete algorithm doesn't
       interruption_point();
+      phaseSpan.reset();
       const float timingExec = timer.elapsed(resetTimer);
+      if (Instrumentation::AlgoTimeRegister::Instance().traceEnabled())
+        addWorkspaceSizesToTrace();
       // The total runtime including all init steps is used for general logging.
       const float duration = timingInit + timingPropertyValidation + timingInputValidation + timingExec;
       // need it to throw before trying to run fillhistory() on an algorithm
       // which has failed
       if (trackingHistory() && m_history) {
+        Instrumentation::TraceSpan historySpan("fillHistory", "phase");
         m_history->fillAlgorithmHistory(this, startTime, duration, Algorithm::g_execCount);
         fillHistory();
         linkHistoryWithLastChild();
@@ -22,7 +22,7 @@ namespace API {
  *  @return true if executed successfully.
  */
 bool Algorithm::execute() {
-  Instrumentation::AlgoTimeRegister::Instance();
+  Instrumentation::AlgoTimeRegister::Instance().updateTraceSettings();
   Instrumentation::AlgoTimeRegisterImpl::Dump dmp(name());
   return executeInternal();
 }
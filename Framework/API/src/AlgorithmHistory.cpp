@@ -23,6 +23,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <mutex>
 #include <sstream>
 #include <utility>
 
@@ -38,6 +39,13 @@ using Types::Core::DateAndTime;
 namespace {
 /// The generator for algorithm history UUIDs
 static boost::uuids::random_generator uuidGen;
+/// Guards uuidGen and the child history lists, as child algorithms may run concurrently
+std::mutex historyMutex;
+
+std::string newUUID() {
+  std::lock_guard<std::mutex> lock(historyMutex);
+  return boost::uuids::to_string(uuidGen());
+}
 } // namespace
 
 /** Constructor
@@ -55,11 +63,11 @@ AlgorithmHistory::AlgorithmHistory(const Algorithm *const alg, const Types::Core
   // Now go through the algorithm's properties and create the PropertyHistory
   // objects.
   setProperties(alg);
-  m_uuid = boost::uuids::to_string(uuidGen());
+  m_uuid = newUUID();
 }
 
 /// Default constructor
-AlgorithmHistory::AlgorithmHistory() : m_uuid(boost::uuids::to_string(uuidGen())) {}
+AlgorithmHistory::AlgorithmHistory() : m_uuid(newUUID()) {}
 
 /**
     Construct AlgorithmHistory by name. Can be used for rstoring the history
@@ -142,6 +150,7 @@ void AlgorithmHistory::addChildHistory(const AlgorithmHistory_sptr &childHist) {
     return;
   }
 
+  std::lock_guard<std::mutex> lock(historyMutex);
   m_childHistories.emplace_back(childHist);
 }
 
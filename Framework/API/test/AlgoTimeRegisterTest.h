@@ -8,6 +8,7 @@
 #pragma once
 
 #include "MantidAPI/AlgoTimeRegister.h"
+#include "MantidJson/Json.h"
 #include "MantidKernel/ConfigService.h"
 #include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/Timer.h"
@@ -17,6 +18,7 @@
 #include <sstream>
 
 using Mantid::Instrumentation::AlgoTimeRegister;
+using Mantid::Instrumentation::TraceSpan;
 using Mantid::Kernel::ConfigService;
 
 class AlgoTimeRegisterTest : public CxxTest::TestSuite {
@@ -47,6 +49,19 @@ public:
     std::filesystem::remove_all(m_directory);
     ConfigService::Instance().setString("performancelog.filename", "");
     ConfigService::Instance().setString("performancelog.write", "Off");
+    ConfigService::Instance().remove("performancelog.tracefilename");
+    AlgoTimeRegister::Instance().updateTraceSettings();
+  }
+
+  /// Read the trace events written so far, closing the JSON array the way a trace viewer would
+  Json::Value readTraceEvents(const std::string &filename) {
+    std::ifstream fs(m_directory + filename);
+    TS_ASSERT(fs.is_open());
+    std::stringstream contents;
+    contents << fs.rdbuf() << "]";
+    Json::Value events;
+    TS_ASSERT(Mantid::JsonHelpers::parse(contents.str(), &events));
+    return events;
   }
 
   void countLines(const int entryCount, const std::string filename = "test.log") {
@@ -190,6 +205,61 @@ public:
     TS_ASSERT(!std::filesystem::exists(m_directory + "noWrite.log"));
   }
 
+  void test_traceSpansAreNestedWithCounters() {
+    ConfigService::Instance().setString("performancelog.tracefilename", m_directory + "trace.json");
+    AlgoTimeRegister::Instance().updateTraceSettings();
+    TS_ASSERT(AlgoTimeRegister::Instance().traceEnabled());
+
+    {
+      TraceSpan outer("LoadSomething", "algorithm");
+      outer.addCounter("bytes_read", 1024);
+      {
+        TraceSpan inner("readEvents");
+        TraceSpan::addToCurrent("events", 5);
+        TraceSpan::addToCurrent("events", 7);
+      }
+    }
+    // Counters without an open span are dropped
+    TraceSpan::addToCurrent("events", 1);
+
+    const auto events = readTraceEvents("trace.json");
+    TS_ASSERT_EQUALS(events.size(), 2);
+    // The inner span closes first so it is written first
+    const auto &inner = events[0];
+    const auto &outer = events[1];
+    TS_ASSERT_EQUALS(inner["name"].asString(), "readEvents");
+    TS_ASSERT_EQUALS(inner["cat"].asString(), "function");
+    TS_ASSERT_EQUALS(inner["ph"].asString(), "X");
+    TS_ASSERT_EQUALS(inner["args"]["depth"].asInt(), 1);
+    TS_ASSERT_EQUALS(inner["args"]["parent"].asString(), "LoadSomething");
+    TS_ASSERT_EQUALS(inner["args"]["events"].asInt64(), 12);
+    TS_ASSERT(inner["args"].isMember("peak_rss_kb"));
+
+    TS_ASSERT_EQUALS(outer["name"].asString(), "LoadSomething");
+    TS_ASSERT_EQUALS(outer["cat"].asString(), "algorithm");
+    TS_ASSERT_EQUALS(outer["args"]["depth"].asInt(), 0);
+    TS_ASSERT_EQUALS(outer["args"]["parent"].asString(), "");
+    TS_ASSERT_EQUALS(outer["args"]["bytes_read"].asInt64(), 1024);
+    TS_ASSERT(!outer["args"].isMember("events"));
+    TS_ASSERT_EQUALS(inner["tid"].asInt(), outer["tid"].asInt());
+    TS_ASSERT_LESS_THAN_EQUALS(outer["ts"].asDouble(), inner["ts"].asDouble());
+    TS_ASSERT_LESS_THAN_EQUALS(inner["ts"].asDouble() + inner["dur"].asDouble(),
+                               outer["ts"].asDouble() + outer["dur"].asDouble());
+  }
+
+  void test_traceDisabledWhenWriteIsOff() {
+    ConfigService::Instance().setString("performancelog.write", "Off");
+    ConfigService::Instance().setString("performancelog.tracefilename", m_directory + "noTrace.json");
+    AlgoTimeRegister::Instance().updateTraceSettings();
+    TS_ASSERT(!AlgoTimeRegister::Instance().traceEnabled());
+    {
+      TraceSpan span("NotRecorded");
+      span.addCounter("events", 1);
+    }
+    TS_ASSERT(!std::filesystem::exists(m_directory + "noTrace.json"));
+    ConfigService::Instance().setString("performancelog.write", "On");
+  }
+
 private:
   const std::string m_directory = "AlgoTimeRegisterTest/";
   std::mutex m_mutex;
@@ -29,6 +29,7 @@
 #include <boost/algorithm/string/classification.hpp>
 #include <boost/algorithm/string/split.hpp>
 #include <map>
+#include <thread>
 #include <utility>
 
 using namespace Mantid::Kernel;
@@ -595,6 +596,32 @@ public:
     }
   }
 
+  /** Two algorithms that each read the workspace the other writes, running
+   * concurrently. The failure mode of this test is HANGING. */
+  void test_lockingWorkspaces_in_opposite_orders_does_not_deadlock() {
+    AnalysisDataService::Instance().addOrReplace("wsA", std::make_shared<WorkspaceTester>());
+    AnalysisDataService::Instance().addOrReplace("wsB", std::make_shared<WorkspaceTester>());
+
+    auto runRepeatedly = [](const std::string &input, const std::string &output) {
+      for (int i = 0; i < 200; ++i) {
+        StubbedWorkspaceAlgorithm alg;
+        alg.initialize();
+        alg.setPropertyValue("InputWorkspace1", input);
+        alg.setPropertyValue("OutputWorkspace1", output);
+        alg.execute();
+      }
+    };
+    std::thread forwards(runRepeatedly, "wsA", "wsB");
+    std::thread backwards(runRepeatedly, "wsB", "wsA");
+    forwards.join();
+    backwards.join();
+
+    TS_ASSERT(AnalysisDataService::Instance().doesExist("wsA"));
+    TS_ASSERT(AnalysisDataService::Instance().doesExist("wsB"));
+    AnalysisDataService::Instance().remove("wsA");
+    AnalysisDataService::Instance().remove("wsB");
+  }
+
   void test_Algorithm_Drops_Workspace_References_When_Stored_In_ADS() {
     // create an input workspace, add it to the ADS
     auto inputWorkspace = std::make_shared<WorkspaceTester>();
@@ -10,6 +10,7 @@
 #include "MantidAPI/DataProcessorAlgorithm.h"
 #include "MantidAPI/WorkspaceHistory.h"
 #include "MantidFrameworkTestHelpers/FakeObjects.h"
+#include "MantidKernel/ConfigService.h"
 #include "MantidKernel/Timer.h"
 #include <cxxtest/TestSuite.h>
 
@@ -213,4 +214,34 @@ public:
     AnalysisDataService::Instance().remove("test_output_workspace");
     AnalysisDataService::Instance().remove("test_input_workspace");
   }
+
+  void test_TopLevelOnly_History_Policy_Skips_Child_Histories() {
+    ConfigService::Instance().setString("algorithms.history.policy", "TopLevelOnly");
+    std::shared_ptr<WorkspaceTester> input = std::make_shared<WorkspaceTester>();
+    AnalysisDataService::Instance().addOrReplace("test_input_workspace", input);
+
+    TopLevelAlgorithm alg;
+    alg.initialize();
+    alg.setRethrows(true);
+    alg.setProperty("InputWorkspace", input);
+    alg.setPropertyValue("OutputWorkspace", "test_output_workspace");
+    TS_ASSERT(!alg.isRecordingHistoryForChild());
+
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    TS_ASSERT(alg.isExecuted());
+
+    auto ws = AnalysisDataService::Instance().retrieveWS<MatrixWorkspace>("test_output_workspace");
+    auto wsHist = ws->getHistory();
+    TS_ASSERT_EQUALS(wsHist.size(), 1);
+
+    // the top level algorithm is still recorded, with all of its properties
+    auto algHist = wsHist.getAlgorithmHistory(0);
+    TS_ASSERT_EQUALS(algHist->name(), "TopLevelAlgorithm");
+    TS_ASSERT_EQUALS(algHist->getPropertyValue("RecordHistory"), "1");
+    TS_ASSERT_EQUALS(algHist->childHistorySize(), 0);
+
+    ConfigService::Instance().remove("algorithms.history.policy");
+    AnalysisDataService::Instance().remove("test_output_workspace");
+    AnalysisDataService::Instance().remove("test_input_workspace");
+  }
 };
@@ -14,6 +14,7 @@
 #include "MantidAPI/TaskBasedAlgorithm.h"
 
 #include <algorithm>
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -152,6 +153,91 @@ public:
   }
 };
 
+// A workflow with two independent branches, Sample and Vanadium, which are combined at the end
+class ConcurrentToyTaskBasedAlg : public Mantid::API::TaskBasedAlgorithm<ConcurrentToyTaskBasedAlg> {
+public:
+  const std::string name() const override { return "ConcurrentToyTaskBasedAlg"; };
+  const std::string summary() const override { return "Toy alg for concurrent task execution test"; }
+  int version() const override { return 1; };
+  void init() override {
+    declareProperty(std::make_unique<Mantid::API::WorkspaceProperty<Mantid::API::MatrixWorkspace>>(
+                        "InputWorkspace", "", Mantid::Kernel::Direction::Input),
+                    "The input workspace to be passed to the first task");
+    declareProperty(std::make_unique<Mantid::API::WorkspaceProperty<Mantid::API::MatrixWorkspace>>(
+                        "OutputWorkspace", "", Mantid::Kernel::Direction::Output),
+                    "Output workspace from final task");
+    declareProperty("Concurrent", true, "Run independent tasks concurrently");
+    declareProperty("FailVanadium", false, "Make the Vanadium task throw");
+    initTaskBasedAlgorithm<Load, Sample, Vanadium, Combine>({"Load", "Sample", "Vanadium", "Combine"});
+  }
+  void exec() override {
+    setConcurrentTaskExecution(getProperty("Concurrent"));
+    execTasks();
+  };
+
+  class Load final : public AlgorithmTask {
+  public:
+    explicit Load(ConcurrentToyTaskBasedAlg *parent) : AlgorithmTask(parent, "Load") {
+      setExpectedOutputs({"LoadOutput"});
+    }
+    void executeImpl() override { outputWorkspace(getDependantWorkspace("InputWorkspace"), "LoadOutput"); };
+  };
+
+  class Sample final : public AlgorithmTask {
+  public:
+    explicit Sample(ConcurrentToyTaskBasedAlg *parent) : AlgorithmTask(parent, "Sample") {
+      setExpectedOutputs({"SampleOutput"});
+      setDependantTask("Load", "LoadOutput", "InputWorkspace");
+    }
+    void executeImpl() override {
+      auto ws = m_parent->cloneWorkspace(getDependantWorkspace("InputWorkspace"));
+      auto &y = ws->mutableY(0);
+      std::transform(y.cbegin(), y.cend(), y.begin(), [](const double value) { return 3.0 * value; });
+      outputWorkspace(ws, "SampleOutput");
+    };
+  };
+
+  class Vanadium final : public AlgorithmTask {
+  public:
+    explicit Vanadium(ConcurrentToyTaskBasedAlg *parent) : AlgorithmTask(parent, "Vanadium") {
+      setExpectedOutputs({"VanadiumOutput"});
+      setDependantTask("Load", "LoadOutput", "InputWorkspace");
+    }
+    void executeImpl() override {
+      if (static_cast<bool>(m_parent->getProperty("FailVanadium")))
+        throw std::runtime_error("Vanadium failed");
+      auto ws = m_parent->cloneWorkspace(getDependantWorkspace("InputWorkspace"));
+      auto &y = ws->mutableY(0);
+      std::transform(y.cbegin(), y.cend(), y.begin(), [](const double value) { return value + 1.0; });
+      outputWorkspace(ws, "VanadiumOutput");
+    };
+  };
+
+  class Combine final : public AlgorithmTask {
+  public:
+    explicit Combine(ConcurrentToyTaskBasedAlg *parent) : AlgorithmTask(parent, "Combine") {
+      setExpectedOutputs({"CombineOutput"});
+      setDependantTask("Sample", "SampleOutput", "Sample");
+      setDependantTask("Vanadium", "VanadiumOutput", "Vanadium");
+    }
+    void executeImpl() override {
+      auto ws = m_parent->cloneWorkspace(getDependantWorkspace("Sample"));
+      const auto &vanadium = getDependantWorkspace("Vanadium")->y(0);
+      auto &y = ws->mutableY(0);
+      std::transform(y.cbegin(), y.cend(), vanadium.cbegin(), y.begin(), std::minus<double>());
+      outputWorkspace(ws, "CombineOutput");
+    };
+  };
+
+  Mantid::API::MatrixWorkspace_sptr cloneWorkspace(const Mantid::API::MatrixWorkspace_sptr &ws) {
+    auto cloneWorkspace = createChildAlgorithm("CloneWorkspace");
+    cloneWorkspace->setProperty("InputWorkspace", ws);
+    cloneWorkspace->execute();
+    Mantid::API::Workspace_sptr wsClone = cloneWorkspace->getProperty("OutputWorkspace");
+    return std::dynamic_pointer_cast<Mantid::API::MatrixWorkspace>(wsClone);
+  }
+};
+
 Mantid::API::MatrixWorkspace_sptr makeMatrixWorkspaceFromVector(const std::vector<double> &yValues,
                                                                 const std::string &outputName = "tmp_ws") {
   const auto nBins = yValues.size();
@@ -191,9 +277,13 @@ public:
     Mantid::API::FrameworkManager::Instance();
     Mantid::API::AnalysisDataService::Instance();
     Mantid::API::AlgorithmFactory::Instance().subscribe<ToyTaskBasedAlg>();
+    Mantid::API::AlgorithmFactory::Instance().subscribe<ConcurrentToyTaskBasedAlg>();
   }
 
-  ~TaskBasedAlgorithmTest() override { Mantid::API::AlgorithmFactory::Instance().unsubscribe("ToyTaskBasedAlg", 1); }
+  ~TaskBasedAlgorithmTest() override {
+    Mantid::API::AlgorithmFactory::Instance().unsubscribe("ToyTaskBasedAlg", 1);
+    Mantid::API::AlgorithmFactory::Instance().unsubscribe("ConcurrentToyTaskBasedAlg", 1);
+  }
 
   void setUp() override { m_alg = Mantid::API::AlgorithmManager::Instance().create("ToyTaskBasedAlg"); }
 
@@ -360,6 +450,36 @@ public:
     TS_ASSERT(Mantid::API::AnalysisDataService::Instance().doesExist("debug_test_0SUFF"));
   }
 
+  void testConcurrentTasksGiveTheSameResultAsSequentialTasks() {
+    for (const bool concurrent : {false, true}) {
+      auto alg = Mantid::API::AlgorithmManager::Instance().create("ConcurrentToyTaskBasedAlg");
+      alg->initialize();
+      alg->setAlwaysStoreInADS(false);
+      alg->setProperty("Concurrent", concurrent);
+      Mantid::API::MatrixWorkspace_sptr inputWS = makeMatrixWorkspaceFromVector({1.0, 2.0, 3.0, 4.0, 5.0});
+      alg->setProperty("InputWorkspace", inputWS);
+      alg->setProperty("OutputWorkspace", "test_ws");
+      alg->execute();
+      TS_ASSERT(alg->isExecuted());
+      Mantid::API::MatrixWorkspace_sptr outputWS = alg->getProperty("OutputWorkspace");
+      compareVectors(outputWS->y(0).rawData(), {1.0, 3.0, 5.0, 7.0, 9.0});
+      // Sample and Vanadium clone their inputs so the input is never modified
+      compareVectors(inputWS->y(0).rawData(), {1.0, 2.0, 3.0, 4.0, 5.0});
+    }
+  }
+
+  void testConcurrentTasksRethrowTheTaskError() {
+    auto alg = Mantid::API::AlgorithmManager::Instance().create("ConcurrentToyTaskBasedAlg");
+    alg->initialize();
+    alg->setAlwaysStoreInADS(false);
+    alg->setRethrows(true);
+    alg->setProperty("FailVanadium", true);
+    Mantid::API::MatrixWorkspace_sptr inputWS = makeMatrixWorkspaceFromVector({1.0, 2.0, 3.0, 4.0, 5.0});
+    alg->setProperty("InputWorkspace", inputWS);
+    alg->setProperty("OutputWorkspace", "test_ws");
+    TS_ASSERT_THROWS_EQUALS(alg->execute(), std::runtime_error & e, std::string(e.what()), "Vanadium failed");
+  }
+
 private:
   Mantid::API::IAlgorithm_sptr m_alg;
 };
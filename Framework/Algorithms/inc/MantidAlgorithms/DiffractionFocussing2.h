@@ -90,6 +90,9 @@ private:
 
   // For events
   void execEvent();
+  template <typename T>
+  void focusEvents(const DataObjects::EventWorkspace &inputWS, DataObjects::EventWorkspace &outputWS,
+                   const bool inPlace, const bool sortEvents);
 
   /// Loop over the workspace and determine the rebin parameters
   /// (Xmin,Xmax,step) for each group.
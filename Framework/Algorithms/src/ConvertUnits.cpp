@@ -11,6 +11,7 @@
 #include "MantidAPI/SpectrumInfo.h"
 #include "MantidAPI/WorkspaceUnitValidator.h"
 #include "MantidDataObjects/EventWorkspace.h"
+#include "MantidDataObjects/UnitConversionHelpers.h"
 #include "MantidDataObjects/Workspace2D.h"
 #include "MantidDataObjects/WorkspaceCreation.h"
 #include "MantidGeometry/Instrument.h"
@@ -383,8 +384,7 @@ MatrixWorkspace_sptr ConvertUnits::convertViaTOF(Kernel::Unit_const_sptr fromUni
     }
   }
 
-  std::vector<std::string> parameters = inputWS->getInstrument()->getStringParameter("show-signed-theta");
-  bool signedTheta = (!parameters.empty()) && find(parameters.begin(), parameters.end(), "Always") != parameters.end();
+  const bool signedTheta = UnitConversionHelpers::useSignedTheta(*inputWS);
 
   auto checkFromUnit = std::unique_ptr<Unit>(fromUnit->clone());
   auto checkOutputUnit = std::unique_ptr<Unit>(outputUnit->clone());
@@ -417,43 +417,9 @@ MatrixWorkspace_sptr ConvertUnits::convertViaTOF(Kernel::Unit_const_sptr fromUni
   PARALLEL_FOR_IF(Kernel::threadSafe(*outputWS))
   for (int64_t i = 0; i < numberOfSpectra_i; ++i) {
     PARALLEL_START_INTERRUPT_REGION
-    double efixed = efixedProp;
-
-    // Now get the detector object for this histogram
-    /// @todo Don't yet consider hold-off (delta)
-    const double delta = 0.0;
-
-    auto localFromUnit = std::unique_ptr<Unit>(fromUnit->clone());
-    auto localOutputUnit = std::unique_ptr<Unit>(outputUnit->clone());
-
-    // TODO toTOF and fromTOF need to be reimplemented outside of kernel
-    UnitParametersMap pmap = {{UnitParams::delta, delta}};
-    if (efixedProp != EMPTY_DBL()) {
-      pmap[UnitParams::efixed] = efixed;
-    }
-    outSpectrumInfo.getDetectorValues(*fromUnit, *outputUnit, emode, signedTheta, i, pmap);
-    try {
-      auto &xValues = outputWS->mutableX(i);
-      localFromUnit->toTOF(xValues.begin(), xValues.end(), l1, emode, pmap);
-      // Convert from time-of-flight to the desired unit
-      localOutputUnit->fromTOF(xValues.begin(), xValues.end(), l1, emode, pmap);
-
-      // EventWorkspace part, modifying the EventLists.
-      if (m_inputEvents) {
-        eventWS->getSpectrum(i).convertUnitsViaTof(localFromUnit.get(), localOutputUnit.get());
-      }
-    } catch (std::runtime_error &) {
-      // Get to here if exception thrown in unit conversion eg when calculating
-      // distance to detector
+    if (!UnitConversionHelpers::convertSpectrumViaTOF(*outputWS, outSpectrumInfo, i, *fromUnit, *outputUnit, l1, emode,
+                                                      signedTheta, efixedProp))
       failedDetectorCount++;
-      // Since you usually (always?) get to here when there's no attached
-      // detectors, this call is
-      // the same as just zeroing out the data (calling clearData on the
-      // spectrum)
-      outputWS->getSpectrum(i).clearData();
-      if (outSpectrumInfo.hasDetectors(i))
-        outSpectrumInfo.setMasked(i, true);
-    }
 
     prog.report("Convert to " + m_outputUnit->unitID());
     PARALLEL_END_INTERRUPT_REGION
@@ -28,6 +28,7 @@
 #include <cfloat>
 #include <iterator>
 #include <numeric>
+#include <type_traits>
 
 using namespace Mantid::Kernel;
 using namespace Mantid::API;
@@ -37,6 +38,34 @@ using std::vector;
 
 namespace Mantid::Algorithms {
 
+namespace {
+/** Merge consecutive runs of events that are each sorted by time-of-flight
+ * into a single sorted vector. Pairs of neighbouring runs are merged
+ * concurrently, halving the number of runs on every pass.
+ *
+ * @param events :: the events to merge
+ * @param boundaries :: the start of every run followed by the end of the last
+ */
+template <typename T> void mergeSortedRuns(std::vector<T> &events, std::vector<size_t> boundaries) {
+  while (boundaries.size() > 2) {
+    const auto numPairs = static_cast<int>((boundaries.size() - 1) / 2);
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 0; i < numPairs; i++) {
+      const auto begin = events.begin();
+      std::inplace_merge(begin + boundaries[2 * i], begin + boundaries[2 * i + 1], begin + boundaries[2 * i + 2]);
+    }
+    // every other boundary has been merged away
+    std::vector<size_t> merged;
+    merged.reserve(boundaries.size() / 2 + 1);
+    for (size_t i = 0; i < boundaries.size(); i += 2)
+      merged.emplace_back(boundaries[i]);
+    if (merged.back() != boundaries.back())
+      merged.emplace_back(boundaries.back());
+    boundaries = std::move(merged);
+  }
+}
+} // namespace
+
 // Register the class into the algorithm factory
 DECLARE_ALGORITHM(DiffractionFocussing2)
 
@@ -72,6 +101,9 @@ void DiffractionFocussing2::init() {
                   "Step parameters for rebin, positive values are constant step-size, negative are logorithmic. One "
                   "value for each output specta or single value which is common to all");
   declareProperty("FullBinsOnly", false, "Omit the final bin if it's width is smaller than the step size");
+  declareProperty("SortEvents", false,
+                  "Sort the events of each focussed spectrum by time-of-flight. Spectra that are already sorted are "
+                  "merged rather than sorted again. Only used when events are preserved.");
 }
 
 std::map<std::string, std::string> DiffractionFocussing2::validateInputs() {
@@ -468,99 +500,31 @@ void DiffractionFocussing2::execEvent() {
 
   std::unique_ptr<Progress> prog = std::make_unique<Progress>(this, 0.2, 0.25, nGroups);
 
-  // determine precount size
-  vector<size_t> size_required(this->m_validGroups.size(), 0);
-  int totalHistProcess = 0;
-  for (size_t iGroup = 0; iGroup < this->m_validGroups.size(); iGroup++) {
-    const vector<size_t> &indices = this->m_wsIndices[iGroup];
-
-    totalHistProcess += static_cast<int>(indices.size());
-    for (auto index : indices) {
-      size_required[iGroup] += eventinputWS->getSpectrum(index).getNumberEvents();
-    }
-    prog->report(1, "Pre-counting");
-  }
-
   // ------------- Pre-allocate Event Lists ----------------------------
-  prog.reset();
-  prog = std::make_unique<Progress>(this, 0.25, 0.3, totalHistProcess);
-
-  // This creates and reserves the space required
+  // This sets the type and spectrum number, the events are sized exactly
+  // when they are scattered into the lists
   for (size_t iGroup = 0; iGroup < this->m_validGroups.size(); iGroup++) {
     const auto group = static_cast<int>(m_validGroups[iGroup]);
     EventList &groupEL = eventOutputW->getSpectrum(iGroup);
     groupEL.switchTo(eventWtype);
     groupEL.clear(true); // remove detector ids
-    groupEL.reserve(size_required[iGroup]);
     groupEL.setSpectrumNo(group);
     prog->reportIncrement(1, "Allocating");
   }
 
   // ----------- Focus ---------------
-  prog.reset();
-  prog = std::make_unique<Progress>(this, 0.3, 0.9, totalHistProcess);
-
-  if (this->m_validGroups.size() == 1) {
-    g_log.information() << "Performing focussing on a single group\n";
-    // Special case of a single group - parallelize differently
-    EventList &groupEL = eventOutputW->getSpectrum(0);
-    const std::vector<size_t> &indices = this->m_wsIndices[0];
-
-    constexpr int chunkSize{200};
-
-    const int end = (totalHistProcess / chunkSize) + 1;
-
-    PRAGMA_OMP(parallel for schedule(dynamic, 1) )
-    for (int wiChunk = 0; wiChunk < end; wiChunk++) {
-      PARALLEL_START_INTERRUPT_REGION
-
-      // Perform in chunks for more efficiency
-      int max = (wiChunk + 1) * chunkSize;
-      if (max > totalHistProcess)
-        max = totalHistProcess;
-
-      // Make a blank EventList that will accumulate the chunk.
-      EventList chunkEL;
-      chunkEL.switchTo(eventWtype);
-      // chunkEL.reserve(numEventsInChunk);
-
-      // process the chunk
-      for (int i = wiChunk * chunkSize; i < max; i++) {
-        // Accumulate the chunk
-        size_t wi = indices[i];
-        chunkEL += eventinputWS->getSpectrum(wi);
-      }
-
-      // Rejoin the chunk with the rest.
-      PARALLEL_CRITICAL(DiffractionFocussing2_JoinChunks) { groupEL += chunkEL; }
-
-      PARALLEL_END_INTERRUPT_REGION
-    }
-    PARALLEL_CHECK_INTERRUPT_REGION
-  } else {
-    // ------ PARALLELIZE BY GROUPS -------------------------
-
-    auto nValidGroups = static_cast<int>(this->m_validGroups.size());
-    PARALLEL_FOR_IF(Kernel::threadSafe(*eventinputWS))
-    for (int iGroup = 0; iGroup < nValidGroups; iGroup++) {
-      PARALLEL_START_INTERRUPT_REGION
-      const std::vector<size_t> &indices = this->m_wsIndices[iGroup];
-      for (auto wi : indices) {
-        // In workspace index iGroup, put what was in the OLD workspace index wi
-        eventOutputW->getSpectrum(iGroup) += eventinputWS->getSpectrum(wi);
-
-        prog->reportIncrement(1, "Appending Lists");
-
-        // When focussing in place, you can clear out old memory from the input
-        // one!
-        if (inPlace) {
-          std::const_pointer_cast<EventWorkspace>(eventinputWS)->getSpectrum(wi).clear(true);
-        }
-      }
-      PARALLEL_END_INTERRUPT_REGION
-    }
-    PARALLEL_CHECK_INTERRUPT_REGION
-  } // (done with parallel by groups)
+  const bool sortEvents = getProperty("SortEvents");
+  switch (eventWtype) {
+  case TOF:
+    focusEvents<Types::Event::TofEvent>(*eventinputWS, *eventOutputW, inPlace, sortEvents);
+    break;
+  case WEIGHTED:
+    focusEvents<WeightedEvent>(*eventinputWS, *eventOutputW, inPlace, sortEvents);
+    break;
+  case WEIGHTED_NOTIME:
+    focusEvents<WeightedEventNoTime>(*eventinputWS, *eventOutputW, inPlace, sortEvents);
+    break;
+  }
 
   // Now that the data is cleaned up, go through it and set the X vectors to the
   // input workspace we first talked about.
@@ -595,6 +559,129 @@ void DiffractionFocussing2::execEvent() {
   setProperty("OutputWorkspace", std::move(eventOutputW));
 }
 
+//=============================================================================
+/** Focus the events of every group into the output workspace.
+ *
+ * The events are counted first so that every contributing spectrum has its own
+ * slot in the exact-sized event vector of its group. The spectra are then
+ * copied into their slots concurrently without any locking, so the work scales
+ * with the number of spectra rather than the number of groups.
+ *
+ * @tparam T :: TofEvent, WeightedEvent or WeightedEventNoTime; the most general
+ *   event type found in the input
+ * @param inputWS :: the workspace being focussed
+ * @param outputWS :: the workspace with one (empty) event list per group
+ * @param inPlace :: clear the input spectra as they are copied
+ * @param sortEvents :: sort the focussed events by time-of-flight
+ */
+template <typename T>
+void DiffractionFocussing2::focusEvents(const EventWorkspace &inputWS, EventWorkspace &outputWS, const bool inPlace,
+                                        const bool sortEvents) {
+  const size_t numGroups = m_validGroups.size();
+
+  // ----------- Count the events and give each spectrum its slot ---------------
+  std::vector<size_t> sourceIndices;
+  std::vector<size_t> sourceOffsets;
+  std::vector<size_t> sourceGroups;
+  // boundaries of the contributing spectra in each group's event vector
+  std::vector<std::vector<size_t>> runBoundaries(numGroups);
+  std::vector<EventSortType> groupOrder(numGroups, UNSORTED);
+  std::vector<bool> runsAreTofSorted(numGroups, true);
+  for (size_t iGroup = 0; iGroup < numGroups; iGroup++) {
+    size_t numEvents = 0;
+    bool isFirstRun = true;
+    runBoundaries[iGroup].emplace_back(0);
+    for (const auto wi : m_wsIndices[iGroup]) {
+      const EventList &inputEL = inputWS.getSpectrum(wi);
+      const size_t numInputEvents = inputEL.getNumberEvents();
+      if (numInputEvents == 0)
+        continue;
+      sourceIndices.emplace_back(wi);
+      sourceOffsets.emplace_back(numEvents);
+      sourceGroups.emplace_back(iGroup);
+      numEvents += numInputEvents;
+      runBoundaries[iGroup].emplace_back(numEvents);
+      // a single contributing list keeps its order, as for EventList::operator+=
+      groupOrder[iGroup] = isFirstRun ? inputEL.getSortType() : UNSORTED;
+      runsAreTofSorted[iGroup] = runsAreTofSorted[iGroup] && inputEL.getSortType() == TOF_SORT;
+      isFirstRun = false;
+    }
+  }
+
+  // ----------- Size the output and collect the detector ids ---------------
+  Progress allocProg(this, 0.25, 0.3, numGroups);
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int iGroup = 0; iGroup < static_cast<int>(numGroups); iGroup++) {
+    EventList &groupEL = outputWS.getSpectrum(iGroup);
+    std::vector<T> *groupEvents;
+    getEventsFrom(groupEL, groupEvents);
+    groupEvents->resize(runBoundaries[iGroup].back());
+    for (const auto wi : m_wsIndices[iGroup])
+      groupEL.addDetectorIDs(inputWS.getSpectrum(wi).getDetectorIDs());
+    allocProg.report("Allocating");
+  }
+
+  // ----------- Copy the events into their slots ---------------
+  std::vector<T *> groupData(numGroups);
+  for (size_t iGroup = 0; iGroup < numGroups; iGroup++) {
+    std::vector<T> *groupEvents;
+    getEventsFrom(outputWS.getSpectrum(iGroup), groupEvents);
+    groupData[iGroup] = groupEvents->data();
+  }
+
+  const auto numSources = static_cast<int>(sourceIndices.size());
+  Progress focusProg(this, 0.3, 0.8, numSources);
+  PRAGMA_OMP(parallel for schedule(dynamic, 1) if (Kernel::threadSafe(inputWS)))
+  for (int i = 0; i < numSources; i++) {
+    PARALLEL_START_INTERRUPT_REGION
+    const EventList &inputEL = inputWS.getSpectrum(sourceIndices[i]);
+    T *destination = groupData[sourceGroups[i]] + sourceOffsets[i];
+    switch (inputEL.getEventType()) {
+    case TOF:
+      std::transform(inputEL.getEvents().cbegin(), inputEL.getEvents().cend(), destination,
+                     [](const auto &event) { return T(event); });
+      break;
+    case WEIGHTED:
+      // the output type is the most general one in the input so this is never a TofEvent
+      if constexpr (!std::is_same_v<T, Types::Event::TofEvent>)
+        std::transform(inputEL.getWeightedEvents().cbegin(), inputEL.getWeightedEvents().cend(), destination,
+                       [](const auto &event) { return T(event); });
+      break;
+    case WEIGHTED_NOTIME:
+      if constexpr (std::is_same_v<T, WeightedEventNoTime>)
+        std::copy(inputEL.getWeightedEventsNoTime().cbegin(), inputEL.getWeightedEventsNoTime().cend(), destination);
+      break;
+    }
+
+    // When focussing in place, you can clear out old memory from the input one!
+    if (inPlace) {
+      const_cast<EventWorkspace &>(inputWS).getSpectrum(sourceIndices[i]).clear(true);
+    }
+    focusProg.report("Appending Lists");
+    PARALLEL_END_INTERRUPT_REGION
+  }
+  PARALLEL_CHECK_INTERRUPT_REGION
+
+  // ----------- Set the order of the focussed events ---------------
+  Progress sortProg(this, 0.8, 0.9, numGroups);
+  for (size_t iGroup = 0; iGroup < numGroups; iGroup++) {
+    const EventList &groupEL = outputWS.getSpectrum(iGroup);
+    groupEL.setSortOrder(groupOrder[iGroup]);
+    if (sortEvents && groupOrder[iGroup] != TOF_SORT) {
+      if (runsAreTofSorted[iGroup]) {
+        // merging the sorted runs is cheaper than sorting from scratch
+        std::vector<T> *groupEvents;
+        getEventsFrom(outputWS.getSpectrum(iGroup), groupEvents);
+        mergeSortedRuns(*groupEvents, std::move(runBoundaries[iGroup]));
+        groupEL.setSortOrder(TOF_SORT);
+      } else {
+        groupEL.sortTof();
+      }
+    }
+    sortProg.report("Sorting");
+  }
+}
+
 //=============================================================================
 /** Verify that all the contributing detectors to a spectrum belongs to the same group
  *
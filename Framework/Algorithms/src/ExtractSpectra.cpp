@@ -244,17 +244,6 @@ void ExtractSpectra::cropRagged(MatrixWorkspace &workspace, int index) {
   }
 }
 
-namespace { // anonymous namespace
-template <class T> void filterEventsHelper(std::vector<T> &events, const double xmin, const double xmax) {
-  events.erase(std::remove_if(events.begin(), events.end(),
-                              [xmin, xmax](const T &event) {
-                                const double tof = event.tof();
-                                return bool(tof < xmin || tof > xmax);
-                              }),
-               events.end());
-}
-} // namespace
-
 /**
  * Executes the algorithm. This does not sort the events because the method of removing events outside of range looks at
  * all of the events.
@@ -283,22 +272,8 @@ void ExtractSpectra::execEvent() {
     PARALLEL_START_INTERRUPT_REGION
     EventList &el = eventW->getSpectrum(i);
 
-    if (!el.empty()) {
-      switch (el.getEventType()) {
-      case TOF: {
-        filterEventsHelper(el.getEvents(), minX_val, maxX_val);
-        break;
-      }
-      case WEIGHTED: {
-        filterEventsHelper(el.getWeightedEvents(), minX_val, maxX_val);
-        break;
-      }
-      case WEIGHTED_NOTIME: {
-        filterEventsHelper(el.getWeightedEventsNoTime(), minX_val, maxX_val);
-        break;
-      }
-      }
-    }
+    if (!el.empty())
+      el.cropTof(minX_val, maxX_val);
 
     // If the X axis is NOT common, then keep the initial X axis, just clear the
     // events, otherwise:
@@ -218,6 +218,57 @@ public:
 
   void test_EventWorkspace_OneGroup_dontPreserveEvents() { dotestEventWorkspace(false, 1, false); }
 
+  void test_EventWorkspace_SortEvents() {
+    constexpr int bankWidthInPixels = 4;
+    const std::string inputWSname("DiffractionFocussing2Test_sort_ws");
+    EventWorkspace_sptr inputW = WorkspaceCreationHelper::createEventWorkspaceWithFullInstrument(2, bankWidthInPixels);
+    const size_t numHist = inputW->getNumberHistograms();
+    for (size_t pix = 0; pix < numHist; pix++) {
+      auto &spectrum = inputW->getSpectrum(pix);
+      spectrum.addEventQuickly(TofEvent(1000.0 - static_cast<double>(pix)));
+      // leave one spectrum unsorted and weighted so both the merge and the sort are exercised
+      if (pix == numHist - 1)
+        spectrum.switchTo(WEIGHTED);
+      else
+        spectrum.sortTof();
+    }
+    const size_t numInputEvents = inputW->getNumberEvents();
+    AnalysisDataService::Instance().addOrReplace(inputWSname, inputW);
+
+    const std::string groupWSName("DiffractionFocussing2Test_sort_group");
+    FrameworkManager::Instance().exec("CreateGroupingWorkspace", 6, "InputWorkspace", inputWSname.c_str(), "GroupNames",
+                                      "bank1,bank2", "OutputWorkspace", groupWSName.c_str());
+
+    DiffractionFocussing2 focus;
+    focus.initialize();
+    focus.setChild(true);
+    TS_ASSERT_THROWS_NOTHING(focus.setPropertyValue("InputWorkspace", inputWSname));
+    TS_ASSERT_THROWS_NOTHING(focus.setPropertyValue("OutputWorkspace", "unused"));
+    TS_ASSERT_THROWS_NOTHING(focus.setPropertyValue("GroupingWorkspace", groupWSName));
+    TS_ASSERT_THROWS_NOTHING(focus.setProperty("SortEvents", true));
+    TS_ASSERT_THROWS_NOTHING(focus.execute());
+    TS_ASSERT(focus.isExecuted());
+
+    MatrixWorkspace_sptr output = focus.getProperty("OutputWorkspace");
+    const auto outputEvent = std::dynamic_pointer_cast<const EventWorkspace>(output);
+    TS_ASSERT(outputEvent);
+    if (!outputEvent)
+      return;
+    TS_ASSERT_EQUALS(outputEvent->getEventType(), WEIGHTED);
+    TS_ASSERT_EQUALS(outputEvent->getNumberHistograms(), 2);
+    TS_ASSERT_EQUALS(outputEvent->getNumberEvents(), numInputEvents);
+    for (size_t wi = 0; wi < outputEvent->getNumberHistograms(); wi++) {
+      const auto &el = outputEvent->getSpectrum(wi);
+      TS_ASSERT_EQUALS(el.getSortType(), TOF_SORT);
+      const auto &events = el.getWeightedEvents();
+      TS_ASSERT(std::is_sorted(events.cbegin(), events.cend()));
+      TS_ASSERT_EQUALS(el.getDetectorIDs().size(), bankWidthInPixels * bankWidthInPixels);
+    }
+
+    AnalysisDataService::Instance().remove(inputWSname);
+    AnalysisDataService::Instance().remove(groupWSName);
+  }
+
   void test_rebin_parameters_histogram() {
     std::string inputWS("DiffractionFocussing2TestParam_ws");
     std::string groupWS("DiffractionFocussing2TestParam_groups");
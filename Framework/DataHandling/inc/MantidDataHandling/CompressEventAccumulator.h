@@ -27,10 +27,15 @@ public:
   virtual ~CompressEventAccumulator() = default; // needed because this is an abstract base class
 
   virtual void addEvent(const float tof) = 0;
+  /// Add an event with a weight and an error of the weight squared. Only accumulators created for weighted events
+  /// support this.
+  virtual void addWeightedEvent(const float tof, const float weight);
   virtual void createWeightedEvents(std::vector<Mantid::DataObjects::WeightedEventNoTime> *raw_events) const = 0;
 
   std::size_t numberHistBins() const;
   virtual double totalWeight() const = 0;
+  /// Whether createWeightedEvents will create any events
+  virtual bool hasEvents() const = 0;
   virtual DataObjects::EventSortType getSortType() const = 0;
 
 protected:
@@ -61,7 +66,7 @@ class MANTID_DATAHANDLING_DLL CompressEventAccumulatorFactory {
 public:
   CompressEventAccumulatorFactory(std::shared_ptr<std::vector<double>> histogram_bin_edges, const double divisor,
                                   CompressBinningMode bin_mode);
-  std::unique_ptr<CompressEventAccumulator> create(const std::size_t num_events);
+  std::unique_ptr<CompressEventAccumulator> create(const std::size_t num_events, const bool weighted = false);
 
 private:
   double m_divisor;
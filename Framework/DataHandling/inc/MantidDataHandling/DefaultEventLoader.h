@@ -10,9 +10,15 @@
 #include "MantidDataHandling/DllConfig.h"
 #include "MantidDataHandling/EventWorkspaceCollection.h"
 
+#include <atomic>
+#include <mutex>
+
 class BankPulseTimes;
 
 namespace Mantid {
+namespace Kernel {
+class Timer;
+}
 namespace DataHandling {
 class LoadEventNexus;
 
@@ -75,6 +81,15 @@ public:
 
   /// One entry of pulse times for each preprocessor
   std::vector<std::shared_ptr<BankPulseTimes>> m_bankPulseTimes;
+  /// Guards m_bankPulseTimes when several banks are read from disk at once
+  std::mutex m_bankPulseTimesMutex;
+
+  /// Time spent reading banks from disk, summed over all tasks, in microseconds
+  std::atomic<uint64_t> m_readMicroseconds{0};
+  /// Time spent creating events from the loaded arrays, summed over all tasks, in microseconds
+  std::atomic<uint64_t> m_processMicroseconds{0};
+  /// Add the time elapsed on a timer to one of the per-phase totals
+  static void addElapsed(std::atomic<uint64_t> &total, const Kernel::Timer &timer);
 
 private:
   DefaultEventLoader(LoadEventNexus *alg, EventWorkspaceCollection &ws, bool haveWeights, bool event_id_is_spec,
@@ -74,6 +74,12 @@ private:
 
   /// Load a file to a given workspace name.
   API::Workspace_sptr loadFileToWs(const std::string &fileName, const std::string &wsName);
+  /// Create the child algorithm that loads a single file.
+  API::IAlgorithm_sptr createFileLoadAlgorithm(const std::string &fileName, const std::string &wsName);
+  /// Load a list of files and sum them into a given workspace name.
+  API::Workspace_sptr loadAndSumFiles(const std::vector<std::string> &fileNames, const std::string &wsName);
+  /// The number of files that may be loaded at the same time when summing.
+  size_t maxConcurrentLoads(const API::Workspace &firstRun) const;
   /// Plus two workspaces together, "in place".
   API::Workspace_sptr plusWs(API::Workspace_sptr ws1, const API::Workspace_sptr &ws2);
   /// Manually group workspaces.
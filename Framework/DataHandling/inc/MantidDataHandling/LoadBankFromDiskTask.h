@@ -23,8 +23,8 @@ namespace DataHandling {
 class BankPulseTimes;
 class DefaultEventLoader;
 
-/** This task does the disk IO from loading the NXS file, and so will be on a
-  disk IO mutex
+/** This task does the disk IO from loading the NXS file. Tasks sharing a
+  disk IO mutex read one at a time.
 */
 class MANTID_DATAHANDLING_DLL LoadBankFromDiskTask : public Kernel::Task {
 
@@ -28,7 +28,8 @@ class MANTID_DATAHANDLING_DLL ProcessBankCompressed : public Mantid::Kernel::Tas
 public:
   ProcessBankCompressed(DefaultEventLoader &m_loader, const std::string &entry_name, Mantid::API::Progress *prog,
                         std::shared_ptr<std::vector<uint32_t>> event_detid,
-                        std::shared_ptr<std::vector<float>> event_tof, size_t startAt,
+                        std::shared_ptr<std::vector<float>> event_tof,
+                        std::shared_ptr<std::vector<float>> event_weight, size_t startAt,
                         std::shared_ptr<std::vector<uint64_t>> event_index,
                         std::shared_ptr<BankPulseTimes> bankPulseTimes, detid_t min_detid, detid_t max_detid,
                         std::shared_ptr<std::vector<double>> histogram_bin_edges, const double divisor);
@@ -63,6 +64,8 @@ private:
   std::shared_ptr<std::vector<uint32_t>> m_event_detid;
   /// event TOF array
   std::shared_ptr<std::vector<float>> m_event_tof;
+  /// event weight array, nullptr if the events are not weighted
+  std::shared_ptr<std::vector<float>> m_event_weight;
   /// index of the first event from event_index
   const size_t m_firstEventIndex;
   /// vector of event index (length of # of pulses)
@@ -75,7 +75,7 @@ private:
   static void appendEventListData(const std::vector<T> &events, size_t offset, double *tofs, float *weights,
                                   float *errorSquareds, int64_t *pulsetimes);
 
-  void execEvent(const Mantid::Nexus::NexusFileIO *nexusFile, const bool uniformSpectra, const bool raggedSpectra,
+  void execEvent(Mantid::Nexus::NexusFileIO *nexusFile, const bool uniformSpectra, const bool raggedSpectra,
                  const std::vector<int> &spec);
   /// sets non workspace properties for the algorithm
   void setOtherProperties(IAlgorithm *alg, const std::string &propertyName, const std::string &propertyValue,
@@ -68,10 +68,14 @@ public:
   /// write table workspace
   int writeNexusTableWorkspace(const API::ITableWorkspace_const_sptr &itableworkspace, const char *group_name) const;
 
-  int writeNexusProcessedDataEventCombined(const DataObjects::EventWorkspace_const_sptr &ws,
-                                           std::vector<int64_t> const &indices, double const *tofs,
-                                           float const *weights, float const *errorSquareds, int64_t const *pulsetimes,
-                                           bool compress) const;
+  /// create the datasets for the combined event lists, leaving the event group open
+  int makeNexusProcessedDataEventCombined(const DataObjects::EventWorkspace_const_sptr &ws,
+                                          std::vector<int64_t> const &indices, bool writeTOF, bool writeWeight,
+                                          bool writeError, bool writePulsetime, bool compress,
+                                          std::size_t chunkSize) const;
+  /// write a block of events into the datasets made by makeNexusProcessedDataEventCombined
+  void writeNexusProcessedDataEventBlock(int64_t start, int64_t size, double const *tofs, float const *weights,
+                                         float const *errorSquareds, int64_t const *pulsetimes) const;
 
   template <typename NumT>
   void writeData(const char *name, NXnumtype datatype, Nexus::DimVector dims_array, NumT const *data,
@@ -9,6 +9,7 @@
 #include "MantidDataObjects/EventList.h"
 
 #include <algorithm>
+#include <numeric>
 #include <tbb/parallel_sort.h>
 
 using Mantid::DataObjects::EventList;
@@ -48,6 +49,10 @@ std::optional<size_t> CompressEventAccumulator::findBin(const float tof) const {
   return m_findBin(*m_histogram_edges.get(), static_cast<double>(tof), m_divisor, m_offset, false);
 }
 
+void CompressEventAccumulator::addWeightedEvent(const float /*tof*/, const float /*weight*/) {
+  throw std::runtime_error("This CompressEventAccumulator does not support weighted events");
+}
+
 // ------------------------------------------------------------------------
 namespace { // anonymous
 
@@ -74,6 +79,8 @@ public:
 
   double totalWeight() const override { return static_cast<double>(m_tof.size()); }
 
+  bool hasEvents() const override { return !m_tof.empty(); }
+
   /**
    * This assumes that the event is within range of the fine histogram
    */
@@ -202,6 +209,8 @@ public:
 
   double totalWeight() const override { return static_cast<double>(m_tof_bin.size()); }
 
+  bool hasEvents() const override { return !m_tof_bin.empty(); }
+
   /**
    * This assumes that the event is within range of the fine histogram
    */
@@ -315,6 +324,10 @@ public:
 
   double totalWeight() const override { return std::accumulate(m_count.cbegin(), m_count.cend(), 0.); }
 
+  bool hasEvents() const override {
+    return std::any_of(m_count.cbegin(), m_count.cend(), [](const auto count) { return count > 0; });
+  }
+
   /**
    * This assumes that the event is within range of the fine histogram
    */
@@ -358,6 +371,157 @@ private:
   std::vector<uint32_t> m_count;
 };
 
+/**
+ * Private class for implementation details of sparse weighted event collection, when there are less events than bins.
+ * The bin and weight of each event are kept until the weighted events are created.
+ */
+class CompressSparseWeighted : public CompressEventAccumulator {
+public:
+  // pass all arguments to the parent
+  CompressSparseWeighted(std::shared_ptr<std::vector<double>> histogram_bin_edges, const size_t numEvents,
+                         const double divisor, CompressBinningMode bin_mode)
+      : CompressEventAccumulator(histogram_bin_edges, divisor, bin_mode), m_is_sorted(false) {
+    m_events.reserve(numEvents);
+    m_initialized = true;
+  }
+
+  double totalWeight() const override {
+    return std::accumulate(m_events.cbegin(), m_events.cend(), 0.,
+                           [](const auto &current, const auto &event) { return current + event.weight; });
+  }
+
+  bool hasEvents() const override { return !m_events.empty(); }
+
+  void addEvent(const float tof) override { this->addWeightedEvent(tof, 1.f); }
+
+  /**
+   * This assumes that the event is within range of the fine histogram. Events with zero weight carry neither signal
+   * nor error, so they are not kept.
+   */
+  void addWeightedEvent(const float tof, const float weight) override {
+    if (weight == 0.f)
+      return;
+    const auto &bin_optional = this->findBin(tof);
+    if (bin_optional) {
+      m_events.push_back({static_cast<uint32_t>(bin_optional.value()), weight});
+    }
+  }
+
+  void createWeightedEvents(std::vector<Mantid::DataObjects::WeightedEventNoTime> *raw_events) const override {
+    // clean out previous version
+    raw_events->clear();
+    m_is_sorted = true;
+    if (m_events.empty())
+      return;
+
+    // stable so the summation order, and the result, does not depend on the sorting algorithm
+    const auto byBin = [](const auto &left, const auto &right) { return left.bin < right.bin; };
+    std::stable_sort(m_events.begin(), m_events.end(), byBin);
+
+    // blindly assume ratio of raw events which are compressed to a single weighed event on average
+    raw_events->reserve(m_events.size() / EXP_COMRESS_RATIO);
+
+    auto iter = m_events.cbegin();
+    const auto iter_end = m_events.cend();
+    while (iter != iter_end) {
+      const auto bin = iter->bin;
+      double weight = 0.;
+      double errorSquared = 0.;
+      for (; iter != iter_end && iter->bin == bin; ++iter) {
+        const auto event_weight = static_cast<double>(iter->weight);
+        weight += event_weight;
+        errorSquared += event_weight * event_weight;
+      }
+      raw_events->emplace_back(this->getBinCenter(bin), weight, errorSquared);
+    }
+  }
+
+  DataObjects::EventSortType getSortType() const override {
+    if (m_is_sorted)
+      return DataObjects::TOF_SORT;
+    else
+      return DataObjects::UNSORTED;
+  }
+
+private:
+  struct BinnedWeight {
+    uint32_t bin;
+    float weight;
+  };
+
+  mutable bool m_is_sorted;
+
+  // time-of-flight bin and weight of every event
+  mutable std::vector<BinnedWeight> m_events;
+};
+
+/**
+ * Private class for implementation details of dense weighted event collection, when there are more events than bins
+ */
+class CompressDenseWeighted : public CompressEventAccumulator {
+public:
+  // pass all arguments to the parent
+  CompressDenseWeighted(std::shared_ptr<std::vector<double>> histogram_bin_edges, const double divisor,
+                        CompressBinningMode bin_mode)
+      : CompressEventAccumulator(histogram_bin_edges, divisor, bin_mode) {}
+
+  double totalWeight() const override { return std::accumulate(m_weight.cbegin(), m_weight.cend(), 0.); }
+
+  bool hasEvents() const override {
+    return std::any_of(m_errorSquared.cbegin(), m_errorSquared.cend(), [](const auto error) { return error > 0.; });
+  }
+
+  void addEvent(const float tof) override { this->addWeightedEvent(tof, 1.f); }
+
+  /**
+   * This assumes that the event is within range of the fine histogram. Events with zero weight carry neither signal
+   * nor error, so they are not kept.
+   */
+  void addWeightedEvent(const float tof, const float weight) override {
+    if (weight == 0.f)
+      return;
+    if (!m_initialized) {
+      this->allocateFineHistogram();
+      m_initialized = true;
+    }
+
+    const auto &bin_optional = this->findBin(tof);
+    if (bin_optional) {
+      const auto event_weight = static_cast<double>(weight);
+      m_weight[bin_optional.value()] += event_weight;
+      m_errorSquared[bin_optional.value()] += event_weight * event_weight;
+    }
+  }
+
+  void createWeightedEvents(std::vector<Mantid::DataObjects::WeightedEventNoTime> *raw_events) const override {
+    if (m_weight.empty())
+      return;
+
+    const auto NUM_BINS = m_weight.size();
+    for (size_t i = 0; i < NUM_BINS; ++i) {
+      // a bin that was hit has a non-zero error, even if the weights cancelled
+      if (m_errorSquared[i] > 0.) {
+        const auto tof = this->getBinCenter(i);
+        raw_events->emplace_back(tof, m_weight[i], m_errorSquared[i]);
+      }
+    }
+  }
+
+  DataObjects::EventSortType getSortType() const override { return DataObjects::TOF_SORT; }
+
+private:
+  void allocateFineHistogram() {
+    const auto NUM_BINS = static_cast<size_t>(m_histogram_edges->size() - 1);
+    m_weight.resize(NUM_BINS, 0.);
+    m_errorSquared.resize(NUM_BINS, 0.);
+  }
+
+  /// sum of the weights of all events seen in an individual bin
+  std::vector<double> m_weight;
+  /// sum of the squared weights of all events seen in an individual bin
+  std::vector<double> m_errorSquared;
+};
+
 } // namespace
 
 // ------------------------------------------------------------------------
@@ -366,7 +530,8 @@ CompressEventAccumulatorFactory::CompressEventAccumulatorFactory(
     std::shared_ptr<std::vector<double>> histogram_bin_edges, const double divisor, CompressBinningMode bin_mode)
     : m_divisor(divisor), m_bin_mode(bin_mode), m_histogram_edges(std::move(histogram_bin_edges)) {}
 
-std::unique_ptr<CompressEventAccumulator> CompressEventAccumulatorFactory::create(const std::size_t num_events) {
+std::unique_ptr<CompressEventAccumulator> CompressEventAccumulatorFactory::create(const std::size_t num_events,
+                                                                                const bool weighted) {
   const auto NUM_EDGES = m_histogram_edges->size();
 
   /*
@@ -382,8 +547,17 @@ std::unique_ptr<CompressEventAccumulator> CompressEventAccumulatorFactory::creat
    * so accumulate the tof/float then sort and histogram the sorted list.
    *
    * The balance is in comparing convert to int + sort + histogram versus sort float + convert some to int + histogram
+   *
+   * Weighted events need the weight of every event, so they only choose between a dense and a sparse accumulator.
    */
 
+  if (weighted) {
+    if (num_events > NUM_EDGES)
+      return std::make_unique<CompressDenseWeighted>(m_histogram_edges, m_divisor, m_bin_mode);
+    else
+      return std::make_unique<CompressSparseWeighted>(m_histogram_edges, num_events, m_divisor, m_bin_mode);
+  }
+
   if (num_events > NUM_EDGES) {
     // this is a dense array
     return std::make_unique<CompressDense>(m_histogram_edges, m_divisor, m_bin_mode);
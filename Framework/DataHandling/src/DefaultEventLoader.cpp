@@ -5,16 +5,26 @@
 //   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidDataHandling/DefaultEventLoader.h"
+#include "MantidAPI/AlgoTimeRegister.h"
 #include "MantidAPI/Progress.h"
 #include "MantidDataHandling/LoadBankFromDiskTask.h"
 #include "MantidDataHandling/LoadEventNexus.h"
+#include "MantidKernel/ConfigService.h"
 #include "MantidKernel/ThreadPool.h"
 #include "MantidKernel/ThreadSchedulerMutexes.h"
+#include "MantidKernel/Timer.h"
 
 using namespace Mantid::Kernel;
 
 namespace Mantid::DataHandling {
 
+namespace {
+/// The number of banks that may be read from disk at the same time. Zero or less means no limit.
+int diskIOConcurrency() {
+  return ConfigService::Instance().getValue<int>("loading.eventnexus.ioconcurrency").value_or(1);
+}
+} // namespace
+
 void DefaultEventLoader::load(LoadEventNexus *alg, EventWorkspaceCollection &ws, bool haveWeights,
                               bool event_id_is_spec, std::vector<std::string> bankNames,
                               const std::vector<int> &periodLog, const std::string &classType,
@@ -24,10 +34,21 @@ void DefaultEventLoader::load(LoadEventNexus *alg, EventWorkspaceCollection &ws,
 
   auto bankRange = loader.setupChunking(bankNames, bankNumEvents);
 
+  Timer wallTimer;
+
   // Make the thread pool
   auto scheduler = new ThreadSchedulerMutexes;
   ThreadPool pool(scheduler);
-  auto diskIOMutex = std::make_shared<std::mutex>();
+  // Tasks sharing a mutex read from disk one at a time, so the number of
+  // mutexes is the number of banks being read concurrently. By default there
+  // is a single mutex as parallel reads only help on storage that can serve
+  // several requests at once, e.g. parallel filesystems and NVMe arrays, and
+  // with an HDF5 library that does not serialise its calls behind a global lock
+  // as the thread-safe builds do.
+  const int ioConcurrency = diskIOConcurrency();
+  std::vector<std::shared_ptr<std::mutex>> diskIOMutexes;
+  for (int i = 0; i < ioConcurrency; ++i)
+    diskIOMutexes.emplace_back(std::make_shared<std::mutex>());
 
   // set up progress bar for the rest of the (multi-threaded) process
   size_t numProg = bankNames.size() * (1 + 3); // 1 = disktask, 3 = proc task
@@ -35,15 +56,36 @@ void DefaultEventLoader::load(LoadEventNexus *alg, EventWorkspaceCollection &ws,
     numProg += bankNames.size() * 3; // 3 = second proc task
   auto prog = std::make_unique<API::Progress>(loader.alg, 0.3, 1.0, numProg);
 
+  size_t numBanksToRead = 0;
   for (size_t i = bankRange.first; i < bankRange.second; i++) {
-    if (bankNumEvents[i] > 0)
+    if (bankNumEvents[i] > 0) {
+      auto diskIOMutex = diskIOMutexes.empty() ? nullptr : diskIOMutexes[numBanksToRead % diskIOMutexes.size()];
       pool.schedule(std::make_shared<LoadBankFromDiskTask>(loader, bankNames[i], classType, bankNumEvents[i],
                                                            oldNeXusFileNames, prog.get(), diskIOMutex, *scheduler,
                                                            periodLog));
+      ++numBanksToRead;
+    }
   }
   // Start and end all threads
   pool.joinAll();
-  diskIOMutex.reset();
+  diskIOMutexes.clear();
+
+  // Report the per-phase timing. The read and process times are summed over
+  // all tasks so they can be larger than the wall-clock time.
+  const auto readMicroseconds = loader.m_readMicroseconds.load();
+  const auto processMicroseconds = loader.m_processMicroseconds.load();
+  alg->getLogger().information() << "Loaded " << numBanksToRead << " banks in " << wallTimer.elapsed()
+                                 << " s with at most "
+                                 << (ioConcurrency > 0 ? std::to_string(ioConcurrency) : std::string("unlimited"))
+                                 << " concurrent reads. Time summed over tasks: reading "
+                                 << static_cast<double>(readMicroseconds) * 1e-6 << " s, processing "
+                                 << static_cast<double>(processMicroseconds) * 1e-6 << " s\n";
+  Instrumentation::TraceSpan::addToCurrent("bank_read_us", static_cast<int64_t>(readMicroseconds));
+  Instrumentation::TraceSpan::addToCurrent("bank_process_us", static_cast<int64_t>(processMicroseconds));
+}
+
+void DefaultEventLoader::addElapsed(std::atomic<uint64_t> &total, const Timer &timer) {
+  total += static_cast<uint64_t>(static_cast<double>(timer.elapsed_no_reset()) * 1e6);
 }
 
 DefaultEventLoader::DefaultEventLoader(LoadEventNexus *alg, EventWorkspaceCollection &ws, bool haveWeights,
@@ -58,18 +100,16 @@ DefaultEventLoader::DefaultEventLoader(LoadEventNexus *alg, EventWorkspaceCollec
     pixelID_to_wi_vector = m_ws.getDetectorIDToWorkspaceIndexVector(pixelID_to_wi_offset, true);
 
   // Cache a map for speed.
-  if (!haveWeights) {
-    if (alg->compressEvents && alg->compressTolerance != 0) {
-      // Convert to weighted events
-      for (size_t i = 0; i < m_ws.getNumberHistograms(); i++) {
-        for (size_t period = 0; period < m_ws.nPeriods(); ++period) {
-          m_ws.getSpectrum(i, period).switchTo(API::WEIGHTED_NOTIME);
-        }
+  if (alg->compressEvents && alg->compressTolerance != 0) {
+    // Convert to weighted events, with or without weights in the file
+    for (size_t i = 0; i < m_ws.getNumberHistograms(); i++) {
+      for (size_t period = 0; period < m_ws.nPeriods(); ++period) {
+        m_ws.getSpectrum(i, period).switchTo(API::WEIGHTED_NOTIME);
       }
-      makeMapToEventLists(weightedNoTimeEventVectors);
-    } else {
-      makeMapToEventLists(eventVectors);
     }
+    makeMapToEventLists(weightedNoTimeEventVectors);
+  } else if (!haveWeights) {
+    makeMapToEventLists(eventVectors);
   } else {
     // Convert to weighted events
     for (size_t i = 0; i < m_ws.getNumberHistograms(); i++) {
@@ -15,16 +15,21 @@
 #include "MantidAPI/MultipleFileProperty.h"
 #include "MantidAPI/WorkspaceGroup.h"
 #include "MantidKernel/ArrayProperty.h"
+#include "MantidKernel/ConfigService.h"
 #include "MantidKernel/FacilityInfo.h"
+#include "MantidKernel/Memory.h"
 
 #include <algorithm>
 #include <cctype>
 #include <cstdio>
 #include <filesystem>
 #include <functional>
+#include <limits>
 #include <numeric>
 #include <set>
 
+#include "tbb/parallel_for.h"
+
 namespace {
 /**
  * Convenience function that returns true if the passed vector of vector of
@@ -77,6 +82,9 @@ std::vector<std::string> flattenVecOfVec(std::vector<std::vector<std::string>> v
 
   return flattenedVec;
 }
+
+/// The prefix of the hidden workspaces holding runs that are waiting to be summed
+const std::string LOAD_SUM_TEMP_PREFIX("__@loadsum_temp@");
 } // namespace
 
 namespace Mantid::DataHandling {
@@ -390,18 +398,9 @@ void Load::loadMultipleFiles() {
   std::vector<API::Workspace_sptr> loadedWsList;
   loadedWsList.reserve(allFilenames.size());
 
-  Workspace_sptr tempWs;
-
   // Cycle through the filenames and wsNames.
   for (auto filenames = allFilenames.cbegin(); filenames != allFilenames.cend(); ++filenames, ++wsName) {
-    auto filename = filenames->cbegin();
-    Workspace_sptr sumWS = loadFileToWs(*filename, *wsName);
-
-    ++filename;
-    for (; filename != filenames->cend(); ++filename) {
-      tempWs = loadFileToWs(*filename, "__@loadsum_temp@");
-      sumWS = plusWs(sumWS, tempWs);
-    }
+    Workspace_sptr sumWS = loadAndSumFiles(*filenames, *wsName);
 
     API::WorkspaceGroup_sptr group = std::dynamic_pointer_cast<WorkspaceGroup>(sumWS);
     if (group) {
@@ -454,15 +453,6 @@ void Load::loadMultipleFiles() {
       setProperty(outWsPropName, childWs);
     }
   }
-
-  // Clean up.
-  if (tempWs) {
-    Algorithm_sptr alg = AlgorithmManager::Instance().createUnmanaged("DeleteWorkspace");
-    alg->initialize();
-    alg->setChild(true);
-    alg->setProperty("Workspace", tempWs);
-    alg->execute();
-  }
 }
 
 /**
@@ -620,6 +610,26 @@ void Load::cancel() {
  * @returns a pointer to the loaded workspace
  */
 API::Workspace_sptr Load::loadFileToWs(const std::string &fileName, const std::string &wsName) {
+  auto loadAlg = createFileLoadAlgorithm(fileName, wsName);
+  loadAlg->executeAsChildAlg();
+
+  Workspace_sptr ws = loadAlg->getProperty("OutputWorkspace");
+  // ws->setName(wsName);
+  AnalysisDataService::Instance().addOrReplace(wsName, ws);
+  m_loader = loadAlg;
+  return ws;
+}
+
+/**
+ * Create a child Load algorithm for a single file, with the properties of
+ * this algorithm.
+ *
+ * @param fileName :: file name to load.
+ * @param wsName   :: the name of the output workspace
+ *
+ * @returns the child algorithm, ready to execute
+ */
+API::IAlgorithm_sptr Load::createFileLoadAlgorithm(const std::string &fileName, const std::string &wsName) {
   auto loadAlg = createChildAlgorithm("Load", 1);
 
   // Get the list properties for the concrete loader load algorithm
@@ -639,14 +649,83 @@ API::Workspace_sptr Load::loadFileToWs(const std::string &fileName, const std::s
       }
     }
   }
+  return loadAlg;
+}
 
-  loadAlg->executeAsChildAlg();
+/**
+ * Load a list of files and sum them, in order, into the workspace loaded from
+ * the first file.
+ *
+ * The remaining files are loaded concurrently in batches. The batch size is
+ * limited by the loading.multifile.concurrency setting and by the number of
+ * runs like the first one that fit into the available memory. Each batch is
+ * then added to the sum in file order, so the result is the same as loading
+ * and adding the files one after another.
+ *
+ * @param fileNames :: the files to load, at least one.
+ * @param wsName    :: the name of the summed workspace.
+ *
+ * @returns a pointer to the summed workspace
+ */
+API::Workspace_sptr Load::loadAndSumFiles(const std::vector<std::string> &fileNames, const std::string &wsName) {
+  Workspace_sptr sumWS = loadFileToWs(fileNames.front(), wsName);
+  // There is no point in a batch larger than the number of files left after the first
+  const size_t batchSize = std::min(maxConcurrentLoads(*sumWS), std::max<size_t>(fileNames.size() - 1, 1));
+  if (fileNames.size() > 2 && batchSize > 1)
+    g_log.information() << "Loading up to " << batchSize << " files at the same time.\n";
+
+  std::vector<std::string> tempWsNames;
+  for (size_t first = 1; first < fileNames.size(); first += batchSize) {
+    const size_t last = std::min(first + batchSize, fileNames.size());
+    std::vector<IAlgorithm_sptr> loadAlgs;
+    for (size_t i = first; i < last; ++i) {
+      if (tempWsNames.size() < last - first)
+        tempWsNames.emplace_back(LOAD_SUM_TEMP_PREFIX + std::to_string(tempWsNames.size()));
+      loadAlgs.emplace_back(createFileLoadAlgorithm(fileNames[i], tempWsNames[i - first]));
+    }
 
-  Workspace_sptr ws = loadAlg->getProperty("OutputWorkspace");
-  // ws->setName(wsName);
-  AnalysisDataService::Instance().addOrReplace(wsName, ws);
-  m_loader = loadAlg;
-  return ws;
+    tbb::parallel_for(static_cast<size_t>(0), loadAlgs.size(),
+                      [&loadAlgs](const size_t i) { loadAlgs[i]->executeAsChildAlg(); });
+
+    for (size_t i = 0; i < loadAlgs.size(); ++i) {
+      Workspace_sptr tempWs = loadAlgs[i]->getProperty("OutputWorkspace");
+      // Group members are looked up by name when summing, so they must be in the ADS
+      AnalysisDataService::Instance().addOrReplace(tempWsNames[i], tempWs);
+      sumWS = plusWs(sumWS, tempWs);
+    }
+    m_loader = loadAlgs.back();
+  }
+
+  // Clean up.
+  for (const auto &tempWsName : tempWsNames) {
+    Algorithm_sptr alg = AlgorithmManager::Instance().createUnmanaged("DeleteWorkspace");
+    alg->initialize();
+    alg->setChild(true);
+    alg->setPropertyValue("Workspace", tempWsName);
+    alg->execute();
+  }
+  return sumWS;
+}
+
+/**
+ * The number of files that may be loaded at the same time when summing runs.
+ *
+ * @param firstRun :: the workspace loaded from the first file, used to
+ * estimate the memory needed by each run.
+ *
+ * @returns the maximum number of concurrent loads, at least 1
+ */
+size_t Load::maxConcurrentLoads(const API::Workspace &firstRun) const {
+  const int configured = ConfigService::Instance().getValue<int>("loading.multifile.concurrency").value_or(1);
+  // Zero or less means no limit other than the memory available
+  size_t maxLoads = configured > 0 ? static_cast<size_t>(configured) : std::numeric_limits<size_t>::max();
+  // Leave room for the temporary buffers the loaders need on top of the workspace
+  const size_t bytesPerRun = 2 * firstRun.getMemorySize();
+  if (bytesPerRun > 0) {
+    const size_t availableBytes = MemoryStats().availMem() * 1024;
+    maxLoads = std::min(maxLoads, availableBytes / bytesPerRun);
+  }
+  return std::max(maxLoads, static_cast<size_t>(1));
 }
 
 /**
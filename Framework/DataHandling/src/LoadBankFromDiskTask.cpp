@@ -36,7 +36,7 @@ namespace Mantid::DataHandling {
  * @param numEvents :: The number of events in the bank.
  * @param oldNeXusFileNames :: Identify if file is of old variety.
  * @param prog :: an optional Progress object
- * @param ioMutex :: a mutex shared for all Disk I-O tasks
+ * @param ioMutex :: a mutex shared by the Disk I-O tasks that may not read at the same time, or null
  * @param scheduler :: the ThreadScheduler that runs this task.
  * @param framePeriodNumbers :: Period numbers corresponding to each frame
  */
@@ -88,6 +88,7 @@ void LoadBankFromDiskTask::loadPulseTimes(Nexus::File &file) {
 
   // Now, we look through existing ones to see if it is already loaded
   // thisBankPulseTimes = NULL;
+  std::lock_guard<std::mutex> lock(m_loader.m_bankPulseTimesMutex);
   for (auto &bankPulseTime : m_loader.m_bankPulseTimes) {
     if (bankPulseTime->equals(thispulseTimes, thisStartTime)) {
       thisBankPulseTimes = bankPulseTime;
@@ -332,7 +333,7 @@ void LoadBankFromDiskTask::run() {
 
     const bool needPulseInfo = (!m_loader.alg->compressEvents) || m_loader.alg->compressTolerance == 0 ||
                                m_loader.m_ws.nPeriods() > 1 || m_loader.alg->m_is_time_filtered ||
-                               m_loader.alg->filter_bad_pulses || m_have_weight;
+                               m_loader.alg->filter_bad_pulses;
 
     // Load the event_index field.
     if (needPulseInfo)
@@ -413,6 +414,7 @@ void LoadBankFromDiskTask::run() {
   // Close up the file even if errors occured.
   file.closeGroup();
   file.close();
+  DefaultEventLoader::addElapsed(m_loader.m_readMicroseconds, timer);
 
   // Abort if anything failed
   if (m_loadError) {
@@ -458,8 +460,8 @@ void LoadBankFromDiskTask::run() {
   const auto numEvents = static_cast<size_t>(m_loadSize[0]);
   const auto startAt = static_cast<size_t>(m_loadStart[0]);
 
-  if ((m_loader.alg->compressEvents) && (!event_weight) && (m_loader.alg->compressTolerance != 0)) {
-    // this method is for unweighted events that the user wants compressed on load
+  if ((m_loader.alg->compressEvents) && (m_loader.alg->compressTolerance != 0)) {
+    // this method is for events that the user wants compressed on load, weights are accumulated if present
 
     // TODO should this be created elsewhere?
     const auto [tof_min, tof_max] = Mantid::Kernel::parallel_minmax(event_time_of_flight);
@@ -506,13 +508,13 @@ void LoadBankFromDiskTask::run() {
 
     // create the tasks
     std::shared_ptr<Task> newTask1 = std::make_shared<ProcessBankCompressed>(
-        m_loader, entry_name, prog, event_id, event_time_of_flight, startAt, event_index, thisBankPulseTimes, m_min_id,
-        mid_id, histogram_bin_edges, m_loader.alg->compressTolerance);
+        m_loader, entry_name, prog, event_id, event_time_of_flight, event_weight, startAt, event_index,
+        thisBankPulseTimes, m_min_id, mid_id, histogram_bin_edges, m_loader.alg->compressTolerance);
     scheduler.push(newTask1);
     if (m_loader.splitProcessing && (mid_id < m_max_id)) {
       std::shared_ptr<Task> newTask2 = std::make_shared<ProcessBankCompressed>(
-          m_loader, entry_name, prog, event_id, event_time_of_flight, startAt, event_index, thisBankPulseTimes,
-          (mid_id + 1), m_max_id, histogram_bin_edges, m_loader.alg->compressTolerance);
+          m_loader, entry_name, prog, event_id, event_time_of_flight, event_weight, startAt, event_index,
+          thisBankPulseTimes, (mid_id + 1), m_max_id, histogram_bin_edges, m_loader.alg->compressTolerance);
       scheduler.push(newTask2);
     }
   } else {
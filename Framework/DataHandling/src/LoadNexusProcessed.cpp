@@ -86,6 +86,67 @@ struct SpectraInfo {
 // Helper typdef.
 using SpectraInfo_optional = std::optional<SpectraInfo>;
 
+/// A contiguous range of events in the file, and where it goes in memory
+struct EventRange {
+  int64_t fileStart;
+  int64_t fileEnd;
+  int64_t bufferStart;
+};
+
+/**
+ * Find the ranges of events in the file that hold the given spectra, merging
+ * spectra that are next to each other in the file.
+ *
+ * @param indices :: index of the first event of each spectrum in the file,
+ * followed by the total number of events
+ * @param spectra :: one-based indices of the spectra to read
+ * @return the ranges of events to read, in file order
+ */
+std::vector<EventRange> eventRangesOfSpectra(const std::vector<int64_t> &indices, std::vector<int> spectra) {
+  std::sort(spectra.begin(), spectra.end());
+  spectra.erase(std::unique(spectra.begin(), spectra.end()), spectra.end());
+  std::vector<EventRange> ranges;
+  int64_t bufferEnd = 0;
+  for (const auto spectrum : spectra) {
+    const auto start = indices[spectrum - 1];
+    const auto end = indices[spectrum];
+    if (!ranges.empty() && ranges.back().fileEnd == start) {
+      ranges.back().fileEnd = end;
+    } else {
+      ranges.push_back({start, end, bufferEnd});
+    }
+    bufferEnd += end - start;
+  }
+  return ranges;
+}
+
+/**
+ * Read the given ranges of a one-dimensional event field into one array.
+ *
+ * @param wksp_cls :: Nexus data for "event_workspace"
+ * @param name :: name of the event field
+ * @param ranges :: ranges of events to read, as found by eventRangesOfSpectra
+ * @return the values of the field, or an empty array if it is not in the file
+ */
+template <typename T>
+std::vector<T> loadEventRanges(const NXData &wksp_cls, const std::string &name, const std::vector<EventRange> &ranges) {
+  std::vector<T> values;
+  if (!wksp_cls.isValid(name))
+    return values;
+  NXDataSetTyped<T> field = wksp_cls.openNXDataSet<T>(name);
+  const auto total = ranges.empty() ? 0 : ranges.back().bufferStart + (ranges.back().fileEnd - ranges.back().fileStart);
+  values.reserve(static_cast<size_t>(total));
+  for (const auto &range : ranges) {
+    const auto size = range.fileEnd - range.fileStart;
+    if (size == 0)
+      continue;
+    field.load(static_cast<dimsize_t>(size), static_cast<dimsize_t>(range.fileStart));
+    const auto &buffer = field.vecBuffer();
+    values.insert(values.end(), buffer.cbegin(), std::next(buffer.cbegin(), size));
+  }
+  return values;
+}
+
 /**
  * Extract ALL the detector, spectrum number and workspace index mapping
  * information.
@@ -693,58 +754,52 @@ API::MatrixWorkspace_sptr LoadNexusProcessed::loadEventEntry(NXData &wksp_cls, N
     unitLabel = indices_data.attributes("units");
   ws->setYUnitLabel(unitLabel);
 
-  // Handle optional fields.
-  // TODO: Handle inconsistent sizes
-  std::vector<int64_t> pulsetimes;
-  if (wksp_cls.isValid("pulsetime")) {
-    NXInt64 pulsetime = wksp_cls.openNXDataSet<int64_t>("pulsetime");
-    pulsetime.load();
-    pulsetimes = pulsetime.vecBuffer();
-  }
-
-  std::vector<double> tofs;
-  if (wksp_cls.isValid("tof")) {
-    NXDouble tof = wksp_cls.openNXDouble("tof");
-    tof.load();
-    tofs = tof.vecBuffer();
-  }
-
-  std::vector<float> error_squareds;
-  if (wksp_cls.isValid("error_squared")) {
-    NXFloat error_squared = wksp_cls.openNXFloat("error_squared");
-    error_squared.load();
-    error_squareds = error_squared.vecBuffer();
-  }
+  // indices of events
+  std::vector<int64_t> indices = indices_data.vecBuffer();
 
-  std::vector<float> weights;
-  if (wksp_cls.isValid("weight")) {
-    NXFloat weight = wksp_cls.openNXFloat("weight");
-    weight.load();
-    weights = weight.vecBuffer();
+  // Only read the events of the requested spectra. Neighbouring spectra are
+  // merged into a single range, so loading everything is still one read.
+  auto max = static_cast<int64_t>(m_filtered_spec_idxs.size());
+  const auto ranges = eventRangesOfSpectra(indices, m_filtered_spec_idxs);
+  // Where the events of each requested spectrum start in the loaded arrays
+  std::vector<int64_t> bufferStart(max);
+  for (int64_t j = 0; j < max; ++j) {
+    const auto fileStart = indices[m_filtered_spec_idxs[j] - 1];
+    const auto range = std::prev(std::upper_bound(ranges.cbegin(), ranges.cend(), fileStart,
+                                                  [](int64_t value, const auto &r) { return value < r.fileStart; }));
+    bufferStart[j] = range->bufferStart + (fileStart - range->fileStart);
   }
 
-  // What type of event lists?
+  // Handle optional fields.
+  // TODO: Handle inconsistent sizes
+  const std::vector<int64_t> pulsetimes = loadEventRanges<int64_t>(wksp_cls, "pulsetime", ranges);
+  const std::vector<double> tofs = loadEventRanges<double>(wksp_cls, "tof", ranges);
+  const std::vector<float> error_squareds = loadEventRanges<float>(wksp_cls, "error_squared", ranges);
+  const std::vector<float> weights = loadEventRanges<float>(wksp_cls, "weight", ranges);
+
+  // What type of event lists? Decided by the fields present in the file, as
+  // the requested spectra may not have any events.
+  const bool hasPulsetime = wksp_cls.isValid("pulsetime");
+  const bool hasTof = wksp_cls.isValid("tof");
+  const bool hasWeight = wksp_cls.isValid("weight") && wksp_cls.isValid("error_squared");
   EventType type = TOF;
-  if (!tofs.empty() && !pulsetimes.empty() && !weights.empty() && !error_squareds.empty())
+  if (hasTof && hasPulsetime && hasWeight)
     type = WEIGHTED;
-  else if ((!tofs.empty() && !weights.empty() && !error_squareds.empty()))
+  else if (hasTof && hasWeight)
     type = WEIGHTED_NOTIME;
-  else if (!pulsetimes.empty() && !tofs.empty())
+  else if (hasPulsetime && hasTof)
     type = TOF;
   else
     throw std::runtime_error("Could not figure out the type of event list!");
 
-  // indices of events
-  std::vector<int64_t> indices = indices_data.vecBuffer();
   // Create all the event lists
-  auto max = static_cast<int64_t>(m_filtered_spec_idxs.size());
   Progress progress(this, progressStart, progressStart + progressRange, max);
   PARALLEL_FOR_NO_WSP_CHECK()
   for (int64_t j = 0; j < max; ++j) {
     PARALLEL_START_INTERRUPT_REGION
     size_t wi = m_filtered_spec_idxs[j] - 1;
-    int64_t index_start = indices[wi];
-    int64_t index_end = indices[wi + 1];
+    int64_t index_start = bufferStart[j];
+    int64_t index_end = index_start + (indices[wi + 1] - indices[wi]);
     if (index_end >= index_start) {
       EventList &el = ws->getSpectrum(j);
       el.switchTo(type);
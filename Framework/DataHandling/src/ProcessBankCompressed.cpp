@@ -19,16 +19,17 @@ namespace Mantid {
 namespace DataHandling {
 ProcessBankCompressed::ProcessBankCompressed(DefaultEventLoader &m_loader, const std::string &entry_name,
                                              API::Progress *prog, std::shared_ptr<std::vector<uint32_t>> event_detid,
-                                             std::shared_ptr<std::vector<float>> event_tof, size_t startAt,
+                                             std::shared_ptr<std::vector<float>> event_tof,
+                                             std::shared_ptr<std::vector<float>> event_weight, size_t startAt,
                                              std::shared_ptr<std::vector<uint64_t>> event_index,
                                              std::shared_ptr<BankPulseTimes> bankPulseTimes, detid_t min_detid,
                                              detid_t max_detid,
                                              std::shared_ptr<std::vector<double>> histogram_bin_edges,
                                              const double divisor)
     : Task(), m_loader(m_loader), m_entry_name(entry_name), m_prog(prog), m_event_detid(std::move(event_detid)),
-      m_event_tof(std::move(event_tof)), m_firstEventIndex(startAt), m_event_index(std::move(event_index)),
-      m_bankPulseTimes(std::move(bankPulseTimes)), m_detid_min(min_detid), m_detid_max(max_detid),
-      m_tof_min(static_cast<float>(histogram_bin_edges->front())),
+      m_event_tof(std::move(event_tof)), m_event_weight(std::move(event_weight)), m_firstEventIndex(startAt),
+      m_event_index(std::move(event_index)), m_bankPulseTimes(std::move(bankPulseTimes)), m_detid_min(min_detid),
+      m_detid_max(max_detid), m_tof_min(static_cast<float>(histogram_bin_edges->front())),
       m_tof_max(static_cast<float>(histogram_bin_edges->back())) {
 
   m_cost = static_cast<double>(m_event_detid->size());
@@ -55,6 +56,7 @@ void ProcessBankCompressed::createAccumulators(const bool precount) {
   const auto NUM_PERIODS = m_loader.m_ws.nPeriods();
   const auto NUM_DETS = static_cast<size_t>(m_detid_max - m_detid_min) + 1;
   const auto NUM_EVENTS_AVG = estimate_avg_events(m_event_detid->size(), NUM_DETS, NUM_PERIODS);
+  const bool weighted = bool(m_event_weight);
 
   std::vector<size_t> counts;
   if (precount) {
@@ -72,9 +74,9 @@ void ProcessBankCompressed::createAccumulators(const bool precount) {
     m_spectra_accum[periodIndex].reserve(NUM_DETS);
     for (size_t det_index = 0; det_index <= NUM_DETS; ++det_index) {
       if (precount)
-        m_spectra_accum[periodIndex].push_back(m_factory->create(counts[det_index]));
+        m_spectra_accum[periodIndex].push_back(m_factory->create(counts[det_index], weighted));
       else
-        m_spectra_accum[periodIndex].push_back(m_factory->create(NUM_EVENTS_AVG));
+        m_spectra_accum[periodIndex].push_back(m_factory->create(NUM_EVENTS_AVG, weighted));
     }
   }
 
@@ -97,7 +99,10 @@ void ProcessBankCompressed::addEvent(const size_t period_index, const size_t eve
 
   // accumulators are zero indexed
   const auto det_index = static_cast<size_t>(detid - m_detid_min);
-  m_spectra_accum[period_index][det_index]->addEvent(tof);
+  if (m_event_weight)
+    m_spectra_accum[period_index][det_index]->addWeightedEvent(tof, m_event_weight->operator[](event_index));
+  else
+    m_spectra_accum[period_index][det_index]->addEvent(tof);
 }
 
 void ProcessBankCompressed::collectEvents() {
@@ -139,6 +144,7 @@ void ProcessBankCompressed::collectEvents() {
 
   m_event_detid.reset();
   m_event_tof.reset();
+  m_event_weight.reset();
   m_event_index.reset();
   m_bankPulseTimes.reset();
 
@@ -181,7 +187,7 @@ public:
   void operator()(const tbb::blocked_range<size_t> &range) const {
     for (size_t index = range.begin(); index < range.end(); ++index) {
       auto &accumulator = m_accumulators->operator[](index);
-      if (accumulator->totalWeight() > 0.) {
+      if (accumulator->hasEvents()) {
         auto *raw_events = m_eventlists->operator[](index + m_detid_min);
         // create the events on the correct event list
         m_accumulators->operator[](index)->createWeightedEvents(raw_events);
@@ -258,6 +264,7 @@ void ProcessBankCompressed::run() {
     }
   }
 
+  DefaultEventLoader::addElapsed(m_loader.m_processMicroseconds, timer);
 #ifndef _WIN32
   if (alg->getLogger().isDebug())
     alg->getLogger().debug() << "Time to ProcessBankCompressed " << m_entry_name << " " << timer << "\n";
@@ -229,6 +229,7 @@ void ProcessBankData::run() {
     alg->discarded_events += my_discarded_events;
   }
 
+  DefaultEventLoader::addElapsed(m_loader.m_processMicroseconds, timer);
 #ifndef _WIN32
   if (alg->getLogger().isDebug())
     alg->getLogger().debug() << "Time to ProcessBankData " << entry_name << " " << timer << "\n";
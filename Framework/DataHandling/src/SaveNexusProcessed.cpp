@@ -21,6 +21,10 @@
 #include "MantidGeometry/Crystal/AngleUnits.h"
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/BoundedValidator.h"
+#include "MantidKernel/ConfigService.h"
+#include <algorithm>
+#include <array>
+#include <future>
 #include <memory>
 #include <utility>
 
@@ -40,6 +44,24 @@ DECLARE_ALGORITHM(SaveNexusProcessed)
 
 namespace {
 
+/// Default number of events copied and written to file at a time
+constexpr size_t EVENTS_PER_BLOCK = 1 << 22;
+
+/// Buffers holding the fields of a block of events
+struct EventBlock {
+  std::vector<double> tofs;
+  std::vector<float> weights;
+  std::vector<float> errorSquareds;
+  std::vector<int64_t> pulsetimes;
+
+  void resize(size_t size, bool writeTOF, bool writeWeight, bool writeError, bool writePulsetime) {
+    tofs.resize(writeTOF ? size : 0);
+    weights.resize(writeWeight ? size : 0);
+    errorSquareds.resize(writeError ? size : 0);
+    pulsetimes.resize(writePulsetime ? size : 0);
+  }
+};
+
 /**
  * Create containers for spectra-detector map writing
  *
@@ -397,9 +419,11 @@ void SaveNexusProcessed::appendEventListData(const std::vector<T> &events, size_
 
 //-----------------------------------------------------------------------------------------------
 /** Execute the saving of event data.
- * This will make one long event list for all events contained.
+ * This will make one long event list for all events contained. The events are
+ * copied and written in blocks of spectra, so only two blocks are held in
+ * memory at once; the copy of one block overlaps the writing of the previous.
  * */
-void SaveNexusProcessed::execEvent(const Mantid::Nexus::NexusFileIO *nexusFile, const bool uniformSpectra,
+void SaveNexusProcessed::execEvent(Mantid::Nexus::NexusFileIO *nexusFile, const bool uniformSpectra,
                                    const bool raggedSpectra, const std::vector<int> &spec) {
   std::vector<int64_t> indices;
   indices.reserve(spec.size() + 1);
@@ -416,15 +440,6 @@ void SaveNexusProcessed::execEvent(const Mantid::Nexus::NexusFileIO *nexusFile,
   // Start by writing out the axes and crap
   nexusFile->writeNexusProcessedData2D(m_eventWorkspace, uniformSpectra, raggedSpectra, spec, "event_workspace", false);
 
-  // Make a super long list of tofs, weights, etc.
-
-  // Initialize all the arrays
-  int64_t num = index;
-  double *tofs = nullptr;
-  float *weights = nullptr;
-  float *errorSquareds = nullptr;
-  int64_t *pulsetimes = nullptr;
-
   // overall event type.
   EventType type = m_eventWorkspace->getEventType();
   bool writeTOF = true;
@@ -447,55 +462,77 @@ void SaveNexusProcessed::execEvent(const Mantid::Nexus::NexusFileIO *nexusFile,
     break;
   }
 
-  // --- Initialize the combined event arrays ----
-  if (writeTOF)
-    tofs = new double[num];
-  if (writeWeight)
-    weights = new float[num];
-  if (writeError)
-    errorSquareds = new float[num];
-  if (writePulsetime)
-    pulsetimes = new int64_t[num];
-
-  // --- Fill in the combined event arrays ----
-  PARALLEL_FOR_NO_WSP_CHECK()
-  for (int wi = 0; wi < static_cast<int>(spec.size()); wi++) {
-    PARALLEL_START_INTERRUPT_REGION
-    const DataObjects::EventList &el = m_eventWorkspace->getSpectrum(spec[wi]);
-
-    // This is where it will land in the output array.
-    // It is okay to write in parallel since none should step on each other.
-    size_t offset = indices[wi];
-
-    switch (el.getEventType()) {
-    case TOF:
-      appendEventListData(el.getEvents(), offset, tofs, weights, errorSquareds, pulsetimes);
-      break;
-    case WEIGHTED:
-      appendEventListData(el.getWeightedEvents(), offset, tofs, weights, errorSquareds, pulsetimes);
-      break;
-    case WEIGHTED_NOTIME:
-      appendEventListData(el.getWeightedEventsNoTime(), offset, tofs, weights, errorSquareds, pulsetimes);
-      break;
-    }
-    m_progress->reportIncrement(el.getNumberEvents(), "Copying EventList");
-
-    PARALLEL_END_INTERRUPT_REGION
-  }
-  PARALLEL_CHECK_INTERRUPT_REGION
-
   /*Default = DONT compress - much faster*/
   bool CompressNexus = getProperty("CompressNexus");
 
-  // Write out to the NXS file.
-  nexusFile->writeNexusProcessedDataEventCombined(m_eventWorkspace, indices, tofs, weights, errorSquareds, pulsetimes,
-                                                  CompressNexus);
+  // Split the spectra into blocks of roughly eventsPerBlock events. A spectrum
+  // is never split, so a block may be larger if a single spectrum is.
+  const auto eventsPerBlock = static_cast<int64_t>(std::max<size_t>(
+      1, ConfigService::Instance().getValue<size_t>("savenexusprocessed.eventsperblock").value_or(EVENTS_PER_BLOCK)));
+  std::vector<size_t> blockStarts{0};
+  for (size_t wi = 1; wi < spec.size(); ++wi) {
+    if (indices[wi] - indices[blockStarts.back()] >= eventsPerBlock)
+      blockStarts.emplace_back(wi);
+  }
+  blockStarts.emplace_back(spec.size());
+
+  nexusFile->makeNexusProcessedDataEventCombined(m_eventWorkspace, indices, writeTOF, writeWeight, writeError,
+                                                 writePulsetime, CompressNexus, static_cast<size_t>(eventsPerBlock));
+
+  // Two sets of arrays: one is filled while the other is being written out
+  std::array<EventBlock, 2> buffers;
+  std::future<void> pendingWrite;
+  for (size_t block = 0; block + 1 < blockStarts.size(); ++block) {
+    const auto firstSpectrum = blockStarts[block];
+    const auto lastSpectrum = blockStarts[block + 1];
+    const int64_t blockStart = indices[firstSpectrum];
+    const int64_t blockSize = indices[lastSpectrum] - blockStart;
+
+    auto &buffer = buffers[block % 2];
+    buffer.resize(static_cast<size_t>(blockSize), writeTOF, writeWeight, writeError, writePulsetime);
+    double *tofs = buffer.tofs.empty() ? nullptr : buffer.tofs.data();
+    float *weights = buffer.weights.empty() ? nullptr : buffer.weights.data();
+    float *errorSquareds = buffer.errorSquareds.empty() ? nullptr : buffer.errorSquareds.data();
+    int64_t *pulsetimes = buffer.pulsetimes.empty() ? nullptr : buffer.pulsetimes.data();
+
+    // --- Fill in the combined event arrays for this block ----
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int64_t wi = static_cast<int64_t>(firstSpectrum); wi < static_cast<int64_t>(lastSpectrum); wi++) {
+      PARALLEL_START_INTERRUPT_REGION
+      const DataObjects::EventList &el = m_eventWorkspace->getSpectrum(spec[wi]);
+
+      // This is where it will land in the output array.
+      // It is okay to write in parallel since none should step on each other.
+      size_t offset = indices[wi] - blockStart;
+
+      switch (el.getEventType()) {
+      case TOF:
+        appendEventListData(el.getEvents(), offset, tofs, weights, errorSquareds, pulsetimes);
+        break;
+      case WEIGHTED:
+        appendEventListData(el.getWeightedEvents(), offset, tofs, weights, errorSquareds, pulsetimes);
+        break;
+      case WEIGHTED_NOTIME:
+        appendEventListData(el.getWeightedEventsNoTime(), offset, tofs, weights, errorSquareds, pulsetimes);
+        break;
+      }
+      m_progress->reportIncrement(el.getNumberEvents(), "Copying EventList");
 
-  // Free mem.
-  delete[] tofs;
-  delete[] weights;
-  delete[] errorSquareds;
-  delete[] pulsetimes;
+      PARALLEL_END_INTERRUPT_REGION
+    }
+    PARALLEL_CHECK_INTERRUPT_REGION
+
+    // Write out to the NXS file once the previous block is done with the file.
+    if (pendingWrite.valid())
+      pendingWrite.get();
+    pendingWrite = std::async(std::launch::async, [=]() {
+      nexusFile->writeNexusProcessedDataEventBlock(blockStart, blockSize, tofs, weights, errorSquareds, pulsetimes);
+    });
+  }
+  if (pendingWrite.valid())
+    pendingWrite.get();
+
+  nexusFile->closeGroup();
 }
 
 //-----------------------------------------------------------------------------------------------
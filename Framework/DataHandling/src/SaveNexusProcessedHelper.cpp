@@ -6,6 +6,7 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 // NexusFileIO
 // @author Ronald Fowler
+#include <algorithm>
 #include <sstream>
 #include <vector>
 
@@ -639,20 +640,24 @@ int NexusFileIO::writeNexusTableWorkspace(const API::ITableWorkspace_const_sptr
 }
 
 //-------------------------------------------------------------------------------------
-/** Write out a combined chunk of event data
+/** Create the datasets holding the combined event lists of a workspace. The
+ * event fields are then written in blocks with
+ * writeNexusProcessedDataEventBlock, and the event group closed with
+ * closeGroup().
  *
  * @param ws :: an EventWorkspace
  * @param indices :: array of event list indexes
- * @param tofs :: array of TOFs
- * @param weights :: array of event weights
- * @param errorSquareds :: array of event squared errors
- * @param pulsetimes :: array of pulsetimes
- * @param compress :: if true, compress the entry
+ * @param writeTOF :: create the TOF dataset
+ * @param writeWeight :: create the event weight dataset
+ * @param writeError :: create the event squared error dataset
+ * @param writePulsetime :: create the pulse time dataset
+ * @param compress :: if true, compress the entries
+ * @param chunkSize :: number of events in each compressed chunk
  */
-int NexusFileIO::writeNexusProcessedDataEventCombined(const DataObjects::EventWorkspace_const_sptr &ws,
-                                                      std::vector<int64_t> const &indices, double const *tofs,
-                                                      float const *weights, float const *errorSquareds,
-                                                      int64_t const *pulsetimes, bool compress) const {
+int NexusFileIO::makeNexusProcessedDataEventCombined(const DataObjects::EventWorkspace_const_sptr &ws,
+                                                     std::vector<int64_t> const &indices, bool writeTOF,
+                                                     bool writeWeight, bool writeError, bool writePulsetime,
+                                                     bool compress, std::size_t chunkSize) const {
   m_filehandle->openGroup("event_workspace", "NXdata");
 
   // The array of indices for each event list #
@@ -669,22 +674,61 @@ int NexusFileIO::writeNexusProcessedDataEventCombined(const DataObjects::EventWo
     m_filehandle->closeData();
   }
 
-  // Write out each field
-  dims_array[0] = static_cast<int>(indices.back()); // TODO big truncation error! This is the # of events
-  if (tofs)
-    writeData("tof", NXnumtype::FLOAT64, dims_array, tofs, compress);
-  if (pulsetimes)
-    writeData("pulsetime", NXnumtype::INT64, dims_array, pulsetimes, compress);
-  if (weights)
-    writeData("weight", NXnumtype::FLOAT32, dims_array, weights, compress);
-  if (errorSquareds)
-    writeData("error_squared", NXnumtype::FLOAT32, std::move(dims_array), errorSquareds, compress);
-
-  // Close up the overall group
-  m_filehandle->closeGroup();
+  // Make each field, sized for all of the events
+  const auto numEvents = static_cast<Nexus::dimsize_t>(indices.empty() ? 0 : indices.back());
+  dims_array[0] = numEvents;
+  // Compressed chunks can not be larger than the dataset, nor empty
+  const bool compressFields = compress && numEvents > 0;
+  const Nexus::DimVector chunk_array = {
+      std::min(numEvents, static_cast<Nexus::dimsize_t>(std::max<std::size_t>(chunkSize, 1)))};
+  const auto makeField = [&](const char *name, NXnumtype datatype) {
+    if (compressFields)
+      m_filehandle->makeCompData(name, datatype, dims_array, m_nexuscompression, chunk_array);
+    else
+      m_filehandle->makeData(name, datatype, dims_array);
+  };
+  if (writeTOF)
+    makeField("tof", NXnumtype::FLOAT64);
+  if (writePulsetime)
+    makeField("pulsetime", NXnumtype::INT64);
+  if (writeWeight)
+    makeField("weight", NXnumtype::FLOAT32);
+  if (writeError)
+    makeField("error_squared", NXnumtype::FLOAT32);
   return 0;
 }
 
+//-------------------------------------------------------------------------------------
+/** Write a contiguous block of events into the datasets created by
+ * makeNexusProcessedDataEventCombined. The arrays that are null are skipped.
+ *
+ * @param start :: index of the first event of the block
+ * @param size :: number of events in the block
+ * @param tofs :: array of TOFs
+ * @param weights :: array of event weights
+ * @param errorSquareds :: array of event squared errors
+ * @param pulsetimes :: array of pulsetimes
+ */
+void NexusFileIO::writeNexusProcessedDataEventBlock(int64_t start, int64_t size, double const *tofs,
+                                                    float const *weights, float const *errorSquareds,
+                                                    int64_t const *pulsetimes) const {
+  if (size <= 0)
+    return;
+  const Nexus::DimVector start_array = {static_cast<Nexus::dimsize_t>(start)};
+  const Nexus::DimVector size_array = {static_cast<Nexus::dimsize_t>(size)};
+  const auto writeSlab = [&](const char *name, auto const *data) {
+    if (!data)
+      return;
+    m_filehandle->openData(name);
+    m_filehandle->putSlab(data, start_array, size_array);
+    m_filehandle->closeData();
+  };
+  writeSlab("tof", tofs);
+  writeSlab("pulsetime", pulsetimes);
+  writeSlab("weight", weights);
+  writeSlab("error_squared", errorSquareds);
+}
+
 //-------------------------------------------------------------------------------------
 /** Write out an array to the open file. */
 template <typename NumT>
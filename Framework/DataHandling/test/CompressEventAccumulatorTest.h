@@ -163,4 +163,51 @@ public:
     constexpr size_t NUM_BINS{24}; // this is observed
     run_logorithm_test(TOF_MIN, TOF_DELTA_HIST, NUM_BINS);
   }
+
+  void test_weighted() {
+    auto tof_fine_bins = std::make_shared<std::vector<double>>();
+    Mantid::Kernel::VectorHelper::createAxisFromRebinParams({0., 10., 100.}, *tof_fine_bins);
+    CompressEventAccumulatorFactory factory(tof_fine_bins, 10., CompressBinningMode::LINEAR);
+
+    // unweighted accumulators cannot take weights
+    TS_ASSERT_THROWS(factory.create(1)->addWeightedEvent(5.f, 2.f), const std::runtime_error &);
+
+    // sparse then dense accumulator
+    for (const std::size_t num_events : {std::size_t{1}, tof_fine_bins->size() + 1}) {
+      auto accumulator = factory.create(num_events, true);
+      // zero weight events carry nothing and are dropped
+      accumulator->addWeightedEvent(45.f, 0.f);
+      TS_ASSERT(!accumulator->hasEvents());
+      // weights that cancel still leave an event with their error
+      accumulator->addWeightedEvent(55.f, 1.f);
+      accumulator->addWeightedEvent(56.f, -1.f);
+      TS_ASSERT(accumulator->hasEvents());
+      accumulator->addWeightedEvent(95.f, 1.f);
+      accumulator->addWeightedEvent(5.f, 2.f);
+      accumulator->addWeightedEvent(15.f, 3.f);
+      accumulator->addWeightedEvent(7.f, -.5f);
+      accumulator->addEvent(96.f);
+      TS_ASSERT_DELTA(accumulator->totalWeight(), 6.5, 1e-9);
+
+      std::vector<DataObjects::WeightedEventNoTime> events;
+      accumulator->createWeightedEvents(&events);
+      TS_ASSERT_EQUALS(accumulator->getSortType(), DataObjects::TOF_SORT);
+      TS_ASSERT_EQUALS(events.size(), 4);
+      if (events.size() != 4)
+        continue;
+      // weights are summed and the errors are the sum of the weights squared
+      TS_ASSERT_EQUALS(events[0].tof(), 5.);
+      TS_ASSERT_EQUALS(events[0].weight(), 1.5);
+      TS_ASSERT_EQUALS(events[0].errorSquared(), 4.25);
+      TS_ASSERT_EQUALS(events[1].tof(), 15.);
+      TS_ASSERT_EQUALS(events[1].weight(), 3.);
+      TS_ASSERT_EQUALS(events[1].errorSquared(), 9.);
+      TS_ASSERT_EQUALS(events[2].tof(), 55.);
+      TS_ASSERT_EQUALS(events[2].weight(), 0.);
+      TS_ASSERT_EQUALS(events[2].errorSquared(), 2.);
+      TS_ASSERT_EQUALS(events[3].tof(), 95.);
+      TS_ASSERT_EQUALS(events[3].weight(), 2.);
+      TS_ASSERT_EQUALS(events[3].errorSquared(), 2.);
+    }
+  }
 };
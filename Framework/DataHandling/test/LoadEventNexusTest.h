@@ -22,6 +22,7 @@
 #include "MantidKernel/TimeSeriesProperty.h"
 #include "MantidNexusGeometry/Hdf5Version.h"
 
+#include <cmath>
 #include <ctime>
 #include <cxxtest/TestSuite.h>
 #include <filesystem>
@@ -127,7 +128,8 @@ private:
    * number of events.
    */
   void validateUncompressedCompressed(EventWorkspace_sptr ws_uncompressed, EventWorkspace_sptr ws_compressed,
-                                      const std::size_t NUM_HIST, const EventType uncompressed_type = EventType::TOF) {
+                                      const std::size_t NUM_HIST, const EventType uncompressed_type = EventType::TOF,
+                                      const double relative_tolerance = 0.) {
     TS_ASSERT_EQUALS(ws_uncompressed->getNumberHistograms(), NUM_HIST);
     TS_ASSERT_EQUALS(ws_compressed->getNumberHistograms(), NUM_HIST);
 
@@ -136,7 +138,17 @@ private:
 
     for (size_t wi = 0; wi < NUM_HIST; wi++) {
       // total counts in uncompressed and compressed should be equal
-      TS_ASSERT_EQUALS(ws_compressed->y(wi), ws_uncompressed->y(wi));
+      if (relative_tolerance == 0.) {
+        TS_ASSERT_EQUALS(ws_compressed->y(wi), ws_uncompressed->y(wi));
+      } else {
+        // summed weights are only equal up to the order of the summation
+        const auto &y_uncompressed = ws_uncompressed->y(wi);
+        const auto &e_uncompressed = ws_uncompressed->e(wi);
+        for (size_t i = 0; i < y_uncompressed.size(); ++i) {
+          TS_ASSERT_DELTA(ws_compressed->y(wi)[i], y_uncompressed[i], relative_tolerance * std::abs(y_uncompressed[i]));
+          TS_ASSERT_DELTA(ws_compressed->e(wi)[i], e_uncompressed[i], relative_tolerance * e_uncompressed[i]);
+        }
+      }
 
       // all uncompressed spectra should be raw events
       TS_ASSERT_EQUALS(ws_uncompressed->getSpectrum(wi).getEventType(), uncompressed_type);
@@ -597,6 +609,40 @@ public:
     }
   }
 
+  void test_concurrent_disk_reads_match_serialised_reads() {
+    // This will use LoadBankFromDiskTask with and without the disk IO limit
+    const std::string filename{"CNCS_7860_event.nxs"};
+    const std::string ioConcurrencyKey{"loading.eventnexus.ioconcurrency"};
+
+    Mantid::API::FrameworkManager::Instance();
+    const auto origIOConcurrency = ConfigService::Instance().getString(ioConcurrencyKey);
+
+    const std::vector<std::pair<std::string, std::string>> loads{{"cncs_serial_reads", "1"},
+                                                                 {"cncs_concurrent_reads", "0"}};
+    for (const auto &[wsName, ioConcurrency] : loads) {
+      ConfigService::Instance().setString(ioConcurrencyKey, ioConcurrency);
+      LoadEventNexus ld;
+      ld.initialize();
+      ld.setPropertyValue("Filename", filename);
+      ld.setPropertyValue("OutputWorkspace", wsName);
+      ld.setProperty("NumberOfBins", 1);
+      ld.setProperty<bool>("LoadLogs", false); // Time-saver
+      ld.execute();
+      TS_ASSERT(ld.isExecuted());
+    }
+    ConfigService::Instance().setString(ioConcurrencyKey, origIOConcurrency);
+
+    auto checkAlg = AlgorithmManager::Instance().create("CompareWorkspaces");
+    checkAlg->setProperty("Workspace1", loads[0].first);
+    checkAlg->setProperty("Workspace2", loads[1].first);
+    checkAlg->execute();
+    TS_ASSERT(checkAlg->getProperty("Result"));
+
+    // cleanup
+    AnalysisDataService::Instance().remove(loads[0].first);
+    AnalysisDataService::Instance().remove(loads[1].first);
+  }
+
   void test_TOF_filtered_loading() {
     std::cout << "test TOF filtering\n" << std::flush;
     const std::string wsName = "test_filtering";
@@ -953,7 +999,8 @@ public:
     TS_ASSERT(ws_compressed); // it is an EventWorkspace
 
     // validate the compressed workspace makes sense compared to uncompressed
-    validateUncompressedCompressed(ws_uncompressed, ws_compressed, NUM_HIST, EventType::WEIGHTED);
+    // the weights are accumulated while loading, in a different order than the histogram of the raw events
+    validateUncompressedCompressed(ws_uncompressed, ws_compressed, NUM_HIST, EventType::WEIGHTED, 1e-5);
 
     // cleanup
     AnalysisDataService::Instance().remove(uncompressed_name);
@@ -438,6 +438,45 @@ public:
     doCommonEventLoadChecks(alg, 5, 2);
   }
 
+  void test_loadEventNexus_List_reads_the_events_of_the_requested_spectra() {
+    writeTmpEventNexus();
+
+    const auto load = [this](const std::string &spectrumList, const std::string &outputName) {
+      LoadNexusProcessed alg;
+      alg.initialize();
+      alg.setPropertyValue("Filename", m_savedTmpEventFile);
+      alg.setPropertyValue("OutputWorkspace", outputName);
+      alg.setPropertyValue("SpectrumList", spectrumList);
+      TS_ASSERT_THROWS_NOTHING(alg.execute());
+      TS_ASSERT(alg.isExecuted());
+      return AnalysisDataService::Instance().retrieveWS<EventWorkspace>(outputName);
+    };
+    auto all = load("", "all_spectra");
+    // Spectra that are not next to each other in the file, one without events
+    auto some = load("2,5,6", "some_spectra");
+    TS_ASSERT_EQUALS(some->getNumberHistograms(), 3);
+
+    const std::vector<size_t> fullIndices{1, 4, 5};
+    for (size_t i = 0; i < fullIndices.size(); ++i) {
+      const auto &expected = all->getSpectrum(fullIndices[i]).getEvents();
+      const auto &actual = some->getSpectrum(i).getEvents();
+      TS_ASSERT_EQUALS(actual.size(), expected.size());
+      for (size_t j = 0; j < std::min(actual.size(), expected.size()); ++j) {
+        TS_ASSERT_EQUALS(actual[j].tof(), expected[j].tof());
+        TS_ASSERT_EQUALS(actual[j].pulseTime(), expected[j].pulseTime());
+      }
+    }
+
+    // Only an empty spectrum: the event type still comes from the file
+    auto empty = load("5", "empty_spectrum");
+    TS_ASSERT_EQUALS(empty->getNumberEvents(), 0);
+    TS_ASSERT_EQUALS(empty->getEventType(), TOF);
+
+    AnalysisDataService::Instance().remove("all_spectra");
+    AnalysisDataService::Instance().remove("some_spectra");
+    AnalysisDataService::Instance().remove("empty_spectrum");
+  }
+
   void test_load_saved_workspace_group() {
     LoadNexusProcessed alg;
     TS_ASSERT_THROWS_NOTHING(alg.initialize());
@@ -281,6 +281,33 @@ public:
     TS_ASSERT_EQUALS(output2D->getNumberHistograms(), 397);
   }
 
+  void test_summing_files_concurrently_matches_summing_them_in_sequence() {
+    const std::string concurrencyKey("loading.multifile.concurrency");
+    const auto origConcurrency = ConfigService::Instance().getString(concurrencyKey);
+
+    const std::vector<std::pair<std::string, std::string>> loads{{"LoadTest_sequential_sum", "1"},
+                                                                 {"LoadTest_concurrent_sum", "0"}};
+    for (const auto &[outputWS, concurrency] : loads) {
+      ConfigService::Instance().setString(concurrencyKey, concurrency);
+      Load loader;
+      loader.initialize();
+      loader.setPropertyValue("Filename", "IRS38633+38633+38633.nxs");
+      loader.setPropertyValue("OutputWorkspace", outputWS);
+      TS_ASSERT_THROWS_NOTHING(loader.execute());
+    }
+    ConfigService::Instance().setString(concurrencyKey, origConcurrency);
+
+    // The temporary workspaces are removed once they have been summed
+    TS_ASSERT(!AnalysisDataService::Instance().doesExist("__@loadsum_temp@0"));
+    TS_ASSERT(!AnalysisDataService::Instance().doesExist("__@loadsum_temp@1"));
+
+    auto checkAlg = AlgorithmManager::Instance().create("CompareWorkspaces");
+    checkAlg->setPropertyValue("Workspace1", loads[0].first);
+    checkAlg->setPropertyValue("Workspace2", loads[1].first);
+    checkAlg->execute();
+    TS_ASSERT(checkAlg->getProperty("Result"));
+  }
+
   void test_EventPreNeXus_WithNoExecute() {
     Load loader;
     loader.initialize();
@@ -26,6 +26,7 @@
 #include "MantidDataObjects/WorkspaceSingleValue.h"
 #include "MantidGeometry/Instrument.h"
 #include "MantidGeometry/Instrument/DetectorInfo.h"
+#include "MantidKernel/ConfigService.h"
 #include "MantidKernel/Strings.h"
 #include "MantidKernel/Unit.h"
 #include "MantidKernel/UnitFactory.h"
@@ -868,6 +869,53 @@ public:
     AnalysisDataService::Instance().remove("testEventRaggedReloaded");
   }
 
+  void test_event_workspace_written_in_several_blocks() {
+    // Make the blocks smaller than the workspace, and not aligned with spectra
+    ConfigService::Instance().setString("savenexusprocessed.eventsperblock", "70");
+    std::vector<std::vector<int>> groups(5);
+    for (int i = 0; i < 5; ++i)
+      groups[i].emplace_back(10 * (i + 1));
+    EventWorkspace_sptr ws = WorkspaceCreationHelper::createGroupedEventWorkspace(groups, 50, 1.0, 1.0);
+    for (size_t wi = 0; wi < ws->getNumberHistograms(); wi++) {
+      ws->getSpectrum(wi).switchTo(WEIGHTED);
+      ws->getSpectrum(wi) *= static_cast<double>(wi + 2);
+    }
+
+    SaveNexusProcessed saveAlg;
+    saveAlg.initialize();
+    saveAlg.setProperty("InputWorkspace", std::dynamic_pointer_cast<Workspace>(ws));
+    FileResource file("SaveNexusProcessedTest_event_blocks.nxs", !clearfiles);
+    saveAlg.setPropertyValue("Filename", file.fullPath());
+    saveAlg.setProperty("CompressNexus", true);
+    TS_ASSERT_THROWS_NOTHING(saveAlg.execute());
+    TS_ASSERT(saveAlg.isExecuted());
+    ConfigService::Instance().remove("savenexusprocessed.eventsperblock");
+
+    LoadNexus loadAlg;
+    loadAlg.initialize();
+    loadAlg.setPropertyValue("Filename", file.fullPath());
+    loadAlg.setPropertyValue("OutputWorkspace", "testEventBlocksReloaded");
+    TS_ASSERT_THROWS_NOTHING(loadAlg.execute());
+
+    auto wsReloaded = AnalysisDataService::Instance().retrieveWS<EventWorkspace>("testEventBlocksReloaded");
+    TS_ASSERT(wsReloaded);
+    if (wsReloaded) {
+      TS_ASSERT_EQUALS(wsReloaded->getNumberHistograms(), ws->getNumberHistograms());
+      TS_ASSERT_EQUALS(wsReloaded->getNumberEvents(), ws->getNumberEvents());
+      for (size_t wi = 0; wi < ws->getNumberHistograms(); wi++) {
+        const auto &expected = ws->getSpectrum(wi).getWeightedEvents();
+        const auto &actual = wsReloaded->getSpectrum(wi).getWeightedEvents();
+        TS_ASSERT_EQUALS(actual.size(), expected.size());
+        for (size_t i = 0; i < std::min(actual.size(), expected.size()); ++i) {
+          TS_ASSERT_EQUALS(actual[i].tof(), expected[i].tof());
+          TS_ASSERT_EQUALS(actual[i].pulseTime(), expected[i].pulseTime());
+          TS_ASSERT_DELTA(actual[i].weight(), expected[i].weight(), 1e-6);
+        }
+      }
+    }
+    AnalysisDataService::Instance().remove("testEventBlocksReloaded");
+  }
+
   void test_ragged_x_bins_input_data_bounds() {
     // Fix SEGFAULT when writing ragged data: respect input vector bounds at `putSlab`.
 
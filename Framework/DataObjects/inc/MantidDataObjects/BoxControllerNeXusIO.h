@@ -85,6 +85,11 @@ public:
    */
   void setEventDataVersion(const size_t &traitsCount);
 
+  /// Compress the "event_data" dataset (byte-shuffle + deflate) when it is created by this object
+  void setCompressEventData(const bool compress) { m_compressEventData = compress; }
+  /// @return true if a newly created "event_data" dataset is compressed
+  bool compressEventData() const { return m_compressEventData; }
+
   /**
    * @brief Number of data items in Nexus dataset "data_event" associated
    * with the particular event data version.
@@ -155,6 +160,9 @@ private:
   /// "data_event" dataset version in the current Nexus file
   EventDataVersion m_EventDataVersion;
 
+  /// if true, the "event_data" dataset is created with shuffle+deflate compressed chunks
+  bool m_compressEventData;
+
   /// the symbolic description of the event types currently supported by the
   /// class
   std::vector<std::string> m_EventsTypesSupported;
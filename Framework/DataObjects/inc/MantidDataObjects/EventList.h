@@ -238,6 +238,8 @@ public:
 
   void maskTof(const double tofMin, const double tofMax) override;
   void maskCondition(const std::vector<bool> &mask) override;
+  /// Remove the events with a tof outside [tofMin, tofMax], without sorting
+  void cropTof(const double tofMin, const double tofMax);
 
   void getTofs(std::vector<double> &tofs) const override;
   double getTofMin() const override;
@@ -419,6 +421,7 @@ private:
   template <class T> void addPulsetimeHelper(std::vector<T> &events, const double seconds);
   template <class T> void addPulsetimesHelper(std::vector<T> &events, const std::vector<double> &seconds);
   template <class T> static std::size_t maskTofHelper(std::vector<T> &events, const double tofMin, const double tofMax);
+  template <class T> static void cropTofHelper(std::vector<T> &events, const double tofMin, const double tofMax);
   template <class T> static std::size_t maskConditionHelper(std::vector<T> &events, const std::vector<bool> &mask);
 
   template <class T> static void getTofsHelper(const std::vector<T> &events, std::vector<double> &tofs);
@@ -12,6 +12,7 @@
 #include "MantidAPI/MDGeometry.h"
 #include "MantidDataObjects/DllConfig.h"
 #include "MantidDataObjects/WorkspaceSingleValue.h"
+#include "MantidDataObjects/ZeroPageAllocator.h"
 #include "MantidGeometry/MDGeometry/IMDDimension.h"
 #include "MantidGeometry/MDGeometry/MDHistoDimension.h"
 #include "MantidGeometry/MDGeometry/MDImplicitFunction.h"
@@ -43,9 +44,11 @@ public:
                    Mantid::API::MDNormalization displayNormalization = Mantid::API::NoNormalization);
 
   MDHistoWorkspace(std::vector<Mantid::Geometry::MDHistoDimension_sptr> &dimensions,
-                   Mantid::API::MDNormalization displayNormalization = Mantid::API::NoNormalization);
+                   Mantid::API::MDNormalization displayNormalization = Mantid::API::NoNormalization,
+                   bool zeroInitialise = false);
   MDHistoWorkspace(std::vector<Mantid::Geometry::IMDDimension_sptr> const &dimensions,
-                   Mantid::API::MDNormalization displayNormalization = Mantid::API::NoNormalization);
+                   Mantid::API::MDNormalization displayNormalization = Mantid::API::NoNormalization,
+                   bool zeroInitialise = false);
   MDHistoWorkspace &operator=(const MDHistoWorkspace &other) = delete;
 
   /// Returns a clone of the workspace
@@ -54,8 +57,8 @@ public:
   /// Returns a default-initialized clone of the workspace
   std::unique_ptr<MDHistoWorkspace> cloneEmpty() const { return std::unique_ptr<MDHistoWorkspace>(doCloneEmpty()); }
 
-  void init(std::vector<Mantid::Geometry::MDHistoDimension_sptr> &dimensions);
-  void init(std::vector<Mantid::Geometry::IMDDimension_sptr> const &dimensions);
+  void init(std::vector<Mantid::Geometry::MDHistoDimension_sptr> &dimensions, bool zeroInitialise = false);
+  void init(std::vector<Mantid::Geometry::IMDDimension_sptr> const &dimensions, bool zeroInitialise = false);
 
   void cacheValues();
 
@@ -398,14 +401,18 @@ private:
   /// Number of dimensions in this workspace
   size_t numDimensions;
 
+  /// Storage for the per-bin arrays. Pages that are never written are not
+  /// committed, so sparsely filled workspaces only pay for the touched bins.
+  using SignalArray = std::vector<signal_t, ZeroPageAllocator<signal_t>>;
+
   /// Linear array of signals for each bin
-  std::vector<signal_t> m_signals;
+  SignalArray m_signals;
 
   /// Linear array of errors for each bin
-  std::vector<signal_t> m_errorsSquared;
+  SignalArray m_errorsSquared;
 
   /// Number of contributing events for each bin.
-  std::vector<signal_t> m_numEvents;
+  SignalArray m_numEvents;
 
   /// Length of the m_signals / m_errorsSquared arrays.
   size_t m_length;
@@ -0,0 +1,38 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidDataObjects/DllConfig.h"
+#include "MantidKernel/DeltaEMode.h"
+#include "MantidKernel/EmptyValues.h"
+
+namespace Mantid {
+namespace Kernel {
+class Unit;
+}
+namespace API {
+class MatrixWorkspace;
+class SpectrumInfo;
+} // namespace API
+namespace DataObjects {
+
+/** Per-spectrum unit conversion via time-of-flight, shared by ConvertUnits and
+ *  the algorithms that convert units as part of a larger per-spectrum pass.
+ */
+struct MANTID_DATAOBJECTS_DLL UnitConversionHelpers {
+  /// Whether the instrument asks for signed scattering angles in unit conversions
+  static bool useSignedTheta(const API::MatrixWorkspace &workspace);
+
+  /// Converts the x-axis, and the events if it holds any, of one spectrum via time-of-flight
+  static bool convertSpectrumViaTOF(API::MatrixWorkspace &workspace, API::SpectrumInfo &spectrumInfo,
+                                    const size_t index, const Kernel::Unit &fromUnit, const Kernel::Unit &toUnit,
+                                    const double l1, const Kernel::DeltaEMode::Type emode, const bool signedTheta,
+                                    const double efixed = EMPTY_DBL());
+};
+
+} // namespace DataObjects
+} // namespace Mantid
@@ -94,8 +94,8 @@ protected:
   /// a vector holding workspace index of monitors in the workspace
   std::vector<specnum_t> m_monitorList;
 
-  /// A vector that holds the 1D histograms
-  std::vector<std::unique_ptr<Histogram1D>> data;
+  /// The 1D histograms, stored contiguously in a single allocation
+  std::vector<Histogram1D> data;
 
 private:
   Workspace2D *doClone() const override;
@@ -0,0 +1,67 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cstdlib>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Mantid {
+namespace DataObjects {
+
+/** ZeroPageAllocator : a standard-library allocator for large, mostly empty
+ * arrays of trivial values.
+ *
+ * Memory is obtained with calloc, which for large requests hands out pages
+ * that the operating system maps lazily and guarantees to be zero-filled.
+ * Value-initialisation of the elements is skipped, so the parts of an array
+ * that are never written do not use any physical memory. Every element of a
+ * freshly allocated container therefore starts as all-bits-zero, i.e. 0.0 for
+ * IEEE floating point types.
+ *
+ * Only containers that are sized once at construction should use this
+ * allocator: growing a vector in place after shrinking it would expose the
+ * stale values left in its spare capacity.
+ */
+template <typename T> class ZeroPageAllocator {
+  static_assert(std::is_trivially_copyable_v<T>, "ZeroPageAllocator only supports trivial element types");
+
+public:
+  using value_type = T;
+
+  ZeroPageAllocator() noexcept = default;
+  template <typename U> ZeroPageAllocator(const ZeroPageAllocator<U> &) noexcept {}
+
+  T *allocate(std::size_t n) {
+    if (auto *p = static_cast<T *>(std::calloc(n, sizeof(T))))
+      return p;
+    throw std::bad_alloc();
+  }
+
+  void deallocate(T *p, std::size_t) noexcept { std::free(p); }
+
+  /// Value-initialisation is a no-op: calloc has already zeroed the memory
+  template <typename U> void construct(U *) noexcept {}
+
+  template <typename U, typename... Args> void construct(U *p, Args &&...args) {
+    ::new (static_cast<void *>(p)) U(std::forward<Args>(args)...);
+  }
+};
+
+template <typename T, typename U>
+bool operator==(const ZeroPageAllocator<T> &, const ZeroPageAllocator<U> &) noexcept {
+  return true;
+}
+
+template <typename T, typename U>
+bool operator!=(const ZeroPageAllocator<T> &, const ZeroPageAllocator<U> &) noexcept {
+  return false;
+}
+
+} // namespace DataObjects
+} // namespace Mantid
@@ -36,7 +36,7 @@ std::string BoxControllerNeXusIO::g_DBDataName("free_space_blocks");
 BoxControllerNeXusIO::BoxControllerNeXusIO(API::BoxController *const bc)
     : m_File(nullptr), m_ReadOnly(true), m_dataChunk(DATA_CHUNK), m_bc(bc), m_BlockStart(2, 0), m_BlockSize(2, 0),
       m_CoordSize(sizeof(coord_t)), m_EventType(FatEvent), m_EventsVersion("1.0"),
-      m_EventDataVersion(EventDataVersion::EDVGoniometer), m_ReadConversion(noConversion) {
+      m_EventDataVersion(EventDataVersion::EDVGoniometer), m_compressEventData(false), m_ReadConversion(noConversion) {
   m_BlockSize[1] = 5 + m_bc->getNDims();
 
   std::copy(std::cbegin(EventHeaders), std::cend(EventHeaders), std::back_inserter(m_EventsTypeHeaders));
@@ -239,11 +239,12 @@ void BoxControllerNeXusIO::prepareNxSToWrite_CurVersion() {
     Nexus::DimVector chunk(m_BlockSize);
     chunk[0] = m_dataChunk;
 
-    // Make and open the data
+    // Make and open the data. The compressed chunks are decompressed transparently on reading.
+    const NXcompression compression = m_compressEventData ? NXcompression::LZW : NXcompression::NONE;
     if (m_CoordSize == 4)
-      m_File->makeCompData("event_data", NXnumtype::FLOAT32, m_BlockSize, NXcompression::NONE, chunk, true);
+      m_File->makeCompData("event_data", NXnumtype::FLOAT32, m_BlockSize, compression, chunk, true);
     else
-      m_File->makeCompData("event_data", NXnumtype::FLOAT64, m_BlockSize, NXcompression::NONE, chunk, true);
+      m_File->makeCompData("event_data", NXnumtype::FLOAT64, m_BlockSize, compression, chunk, true);
 
     // A little bit of description for humans to read later
     m_File->putAttr("description", m_EventsTypeHeaders[m_EventType]);
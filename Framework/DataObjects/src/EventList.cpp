@@ -87,6 +87,27 @@ public:
     return (tAtSample1 < tAtSample2);
   }
 };
+
+/**
+ * Find the first element of a sorted range that is not less than value,
+ * searching forwards from first with a doubling step. The cost is logarithmic
+ * in the distance to the result rather than the length of the range.
+ * @param first :: start of the sorted range
+ * @param last :: end of the sorted range
+ * @param value :: value to search for
+ * @return iterator to the first element that is not less than value
+ */
+template <typename Iterator, typename T>
+Iterator gallopingLowerBound(Iterator first, const Iterator last, const T &value) {
+  auto remaining = std::distance(first, last);
+  decltype(remaining) step = 1;
+  while (step < remaining && *(first + step) < value) {
+    first += step;
+    remaining -= step;
+    step *= 2;
+  }
+  return std::lower_bound(first, first + std::min(step, remaining), value);
+}
 } // namespace
 //==========================================================================
 /// --------------------- TofEvent Comparators
@@ -1566,13 +1587,88 @@ inline double calcNorm(const double errorSquared) {
   else
     return 1. / std::sqrt(errorSquared);
 }
+
+/// TOF groups of constant width for compressing events. An event joins the
+/// current group while its TOF is no more than the tolerance past the first
+/// event of the group
+struct LinearTofGroups {
+  double tolerance;
+  bool contains(const double tof, const double groupEnd) const { return tof <= groupEnd; }
+  double next(const double tof, const double) const { return tof + tolerance; }
+};
+
+/// TOF groups on the logarithmic grid of the Rebin algorithm, starting from
+/// the smallest TOF. The tolerance is negative
+struct LogTofGroups {
+  double tolerance;
+  bool contains(const double tof, const double groupEnd) const { return tof < groupEnd; }
+  double next(const double tof, double groupEnd) const {
+    // advance the group end until we find the one that this next event falls into
+    while (tof >= groupEnd)
+      groupEnd = groupEnd * (1 - tolerance);
+    return groupEnd;
+  }
+};
+
+/**
+ * Count the events that compressing the sorted events will produce.
+ * @param events :: events sorted by TOF, not empty
+ * @param groups :: LinearTofGroups or LogTofGroups
+ * @param groupEnd :: the end of the first group
+ */
+template <class T, class Groups>
+size_t countCompressedEvents(const std::vector<T> &events, const Groups &groups, double groupEnd) {
+  size_t numGroups = 1;
+  for (const auto &event : events) {
+    const double tof = event.tof();
+    if (!groups.contains(tof, groupEnd)) {
+      ++numGroups;
+      groupEnd = groups.next(tof, groupEnd);
+    }
+  }
+  return numGroups;
+}
+
+/**
+ * Append an event to the output of a compression, or overwrite the slot of an
+ * event that has already been consumed when compressing in place.
+ */
+template <class T> class CompressedEventWriter {
+public:
+  CompressedEventWriter(std::vector<T> &out, const bool inPlace) : m_out(out), m_inPlace(inPlace) {}
+  template <class... Args> void write(Args &&...args) {
+    if (m_inPlace)
+      m_out[m_size] = T(std::forward<Args>(args)...);
+    else
+      m_out.emplace_back(std::forward<Args>(args)...);
+    ++m_size;
+  }
+  /// Drop the consumed input left behind an in-place compression
+  void finish() {
+    if (m_inPlace)
+      m_out.erase(m_out.begin() + m_size, m_out.end());
+    // If you have over-allocated by more than 5%, reduce the size.
+    if ((m_out.capacity() - m_out.size()) > m_out.size() / 20)
+      m_out.shrink_to_fit();
+  }
+
+private:
+  std::vector<T> &m_out;
+  const bool m_inPlace;
+  size_t m_size{0};
+};
 } // namespace
 
 // --------------------------------------------------------------------------
 /** Compress the event list by grouping events with the same TOF.
+ *
+ * The output is sized exactly by counting the groups before filling them.
+ * When events and out are the same vector the events are compressed in
+ * place: every output event replaces input events that have already been
+ * consumed.
  *
  * @param events :: input event list.
- * @param out :: output WeightedEventNoTime vector.
+ * @param out :: output WeightedEventNoTime vector. Can be the same as events.
  * @param tolerance :: how close do two event's TOF have to be to be considered
  *the same. Negative implies log grouping.
  */
@@ -1580,241 +1676,216 @@ inline double calcNorm(const double errorSquared) {
 template <class T>
 inline void EventList::compressEventsHelper(const std::vector<T> &events, std::vector<WeightedEventNoTime> &out,
                                             double tolerance) {
-  // Clear the output. We can't know ahead of time how much space to reserve :(
-  out.clear();
-  // We will make a starting guess of 1/20th of the number of input events.
-  out.reserve(events.size() / 20);
-
-  // The last TOF to which we are comparing.
-  double lastTof = events.front().m_tof;
-  // For getting an accurate average TOF
-  double totalTof = 0;
-  int num = 0;
-  // Carrying weight, error, and normalization
-  double weight = 0;
-  double errorSquared = 0;
-  double normalization = 0.;
-
-  double bin_end = lastTof;
-  std::function<bool(const double, const double)> compareTof;
-  std::function<double(const double, double)> next_bin;
-
-  if (tolerance < 0) { // log
-    if (lastTof < 0)
-      throw std::runtime_error("compressEvents with log binning doesn't work with negative TOF");
-
-    if (lastTof == 0)
-      bin_end = fabs(tolerance);
-
-    // for log we do "less than" so that is matches the log binning of the Rebin algorithm
-    compareTof = [](const double lhs, const double rhs) { return lhs < rhs; };
-    next_bin = [tolerance](const double lastTof, double bin_end) {
-      // advance the bin_end until we find the one that this next event falls into
-      while (lastTof >= bin_end)
-        bin_end = bin_end * (1 - tolerance);
-      return bin_end;
-    };
-  } else { // linear
-    // for linear we do "less than or equals" because that is how it was originally implemented
-    compareTof = [](const double lhs, const double rhs) { return lhs <= rhs; };
-    next_bin = [tolerance](const double lastTof, double) { return lastTof + tolerance; };
-  }
-
-  // get first bin_end
-  bin_end = next_bin(lastTof, bin_end);
-
-  for (auto it = events.cbegin(); it != events.cend(); it++) {
-    if (compareTof(it->m_tof, bin_end)) {
-      // Carry the error and weight
-      weight += it->weight();
-      errorSquared += it->errorSquared();
-      // Track the average tof
-      num++;
-      const double norm = calcNorm(it->errorSquared());
-      normalization += norm;
-      totalTof += it->m_tof * norm;
-    } else {
-      // We exceeded the tolerance
-      // Create a new event with the average TOF and summed weights and
-      // squared errors.
-      if (num == 1) {
-        // last time-of-flight is the only one contributing
-        out.emplace_back(lastTof, weight, errorSquared);
-      } else if (num > 1) {
-        out.emplace_back(totalTof / normalization, weight, errorSquared);
+  const bool inPlace = static_cast<const void *>(&events) == static_cast<const void *>(&out);
+
+  // The group boundaries are templated rather than std::function so the
+  // comparison in the loop over every event can be inlined
+  const auto compress = [&events, &out, inPlace](const auto &groups, double groupEnd) {
+    if (!inPlace) {
+      out.clear();
+      out.reserve(countCompressedEvents(events, groups, groupEnd));
+    }
+    CompressedEventWriter<WeightedEventNoTime> writer(out, inPlace);
+
+    // The last TOF to which we are comparing.
+    double lastTof = events.front().m_tof;
+    // For getting an accurate average TOF
+    double totalTof = 0;
+    int num = 0;
+    // Carrying weight, error, and normalization
+    double weight = 0;
+    double errorSquared = 0;
+    double normalization = 0.;
+
+    for (auto it = events.cbegin(); it != events.cend(); it++) {
+      if (groups.contains(it->m_tof, groupEnd)) {
+        // Carry the error and weight
+        weight += it->weight();
+        errorSquared += it->errorSquared();
+        // Track the average tof
+        num++;
+        const double norm = calcNorm(it->errorSquared());
+        normalization += norm;
+        totalTof += it->m_tof * norm;
+      } else {
+        // We exceeded the tolerance
+        // Create a new event with the average TOF and summed weights and
+        // squared errors.
+        if (num == 1) {
+          // last time-of-flight is the only one contributing
+          writer.write(lastTof, weight, errorSquared);
+        } else if (num > 1) {
+          writer.write(totalTof / normalization, weight, errorSquared);
+        }
+        // Start a new combined object
+        num = 1;
+        const double norm = calcNorm(it->errorSquared());
+        normalization = norm;
+        totalTof = it->m_tof * norm;
+        weight = it->weight();
+        errorSquared = it->errorSquared();
+        lastTof = it->m_tof;
+
+        groupEnd = groups.next(lastTof, groupEnd);
       }
-      // Start a new combined object
-      num = 1;
-      const double norm = calcNorm(it->errorSquared());
-      normalization = norm;
-      totalTof = it->m_tof * norm;
-      weight = it->weight();
-      errorSquared = it->errorSquared();
-      lastTof = it->m_tof;
-
-      bin_end = next_bin(lastTof, bin_end);
     }
-  }
 
-  // Put the last event in there too with the average TOF and summed weights and
-  // squared errors.
-  if (num == 1) {
-    // last time-of-flight is the only one contributing
-    out.emplace_back(lastTof, weight, errorSquared);
-  } else if (num > 1) {
-    out.emplace_back(totalTof / normalization, weight, errorSquared);
-  }
+    // Put the last event in there too with the average TOF and summed weights and
+    // squared errors.
+    if (num == 1) {
+      // last time-of-flight is the only one contributing
+      writer.write(lastTof, weight, errorSquared);
+    } else if (num > 1) {
+      writer.write(totalTof / normalization, weight, errorSquared);
+    }
+    writer.finish();
+  };
 
-  // If you have over-allocated by more than 5%, reduce the size.
-  size_t excess_limit = out.size() / 20;
-  if ((out.capacity() - out.size()) > excess_limit) {
-    out.shrink_to_fit();
+  const double firstTof = events.front().m_tof;
+  if (tolerance < 0) { // log
+    if (firstTof < 0)
+      throw std::runtime_error("compressEvents with log binning doesn't work with negative TOF");
+    const LogTofGroups groups{tolerance};
+    // can't start at 0 as this will create an infinite loop
+    compress(groups, groups.next(firstTof, firstTof == 0 ? fabs(tolerance) : firstTof));
+  } else { // linear
+    const LinearTofGroups groups{tolerance};
+    compress(groups, groups.next(firstTof, firstTof));
   }
 }
 
+/** Compress the events by grouping events with the same TOF within each
+ * wall-clock interval of the pulse time. When events and out are the same
+ * vector the events are compressed in place.
+ */
 template <class T>
 inline void EventList::compressFatEventsHelper(const std::vector<T> &events, std::vector<WeightedEvent> &out,
                                                const double tolerance, const Types::Core::DateAndTime &timeStart,
                                                const double seconds) {
-  // Clear the output. We can't know ahead of time how much space to reserve :(
-  out.clear();
-  // We will make a starting guess of 1/20th of the number of input events.
-  out.reserve(events.size() / 20);
-
-  // The last TOF to which we are comparing.
-  double lastTof = events.front().m_tof;
-  // For getting an accurate average TOF
-  double totalTof = 0;
+  const bool inPlace = static_cast<const void *>(&events) == static_cast<const void *>(&out);
+  if (!inPlace) {
+    out.clear();
+    // We will make a starting guess of 1/20th of the number of input events.
+    out.reserve(events.size() / 20);
+  }
 
   // pulsetime bin information - stored as int nanoseconds because it
   // is the implementation type for DateAndTime object
   const int64_t pulsetimeStart = timeStart.totalNanoseconds();
   const auto pulsetimeDelta = static_cast<int64_t>(seconds * SEC_TO_NANO);
 
-  // pulsetime information
-  std::vector<DateAndTime> pulsetimes; // all the times for new event
-  std::vector<double> pulsetimeWeights;
-
-  // Carrying weight and error
-  double weight = 0.;
-  double errorSquared = 0.;
-  double tofNormalization = 0.;
-
   // Move up to first event that has a large enough pulsetime. This is just in case someone starts from after the
   // starttime of the run. It is expected that users will normally use the default which means this will only check the
   // first event.
-  auto it = events.cbegin();
-  for (; it != events.cend(); ++it) {
-    if (it->m_pulsetime >= timeStart)
+  auto first = events.cbegin();
+  for (; first != events.cend(); ++first) {
+    if (first->m_pulsetime >= timeStart)
       break;
   }
 
-  if (it == events.cend())
+  if (first == events.cend())
     throw std::runtime_error("failed to find first pulse time in the events");
 
-  // bin if the pulses are histogrammed
-  int64_t lastPulseBin = (it->m_pulsetime.totalNanoseconds() - pulsetimeStart) / pulsetimeDelta;
+  const auto compress = [&events, &out, inPlace, first, pulsetimeStart, pulsetimeDelta](const auto &groups,
+                                                                                          const double tof_min) {
+    CompressedEventWriter<WeightedEvent> writer(out, inPlace);
+
+    // The last TOF to which we are comparing.
+    double lastTof = events.front().m_tof;
+    // For getting an accurate average TOF
+    double totalTof = 0;
+
+    // pulsetime information
+    std::vector<DateAndTime> pulsetimes; // all the times for new event
+    std::vector<double> pulsetimeWeights;
+
+    // Carrying weight and error
+    double weight = 0.;
+    double errorSquared = 0.;
+    double tofNormalization = 0.;
+
+    // bin if the pulses are histogrammed
+    int64_t lastPulseBin = (first->m_pulsetime.totalNanoseconds() - pulsetimeStart) / pulsetimeDelta;
+
+    // get first bin_end
+    double bin_end = groups.next(lastTof, tof_min);
+
+    // loop through events and accumulate weight
+    for (auto it = first; it != events.cend(); ++it) {
+      const int64_t eventPulseBin = (it->m_pulsetime.totalNanoseconds() - pulsetimeStart) / pulsetimeDelta;
+      if ((eventPulseBin <= lastPulseBin) && groups.contains(it->m_tof, bin_end)) {
+        // Carry the error and weight
+        weight += it->weight();
+        errorSquared += it->errorSquared();
+        double norm = calcNorm(it->errorSquared());
+        tofNormalization += norm;
+        // Track the average tof
+        totalTof += it->m_tof * norm;
+        // Accumulate the pulse times
+        pulsetimes.emplace_back(it->m_pulsetime);
+        pulsetimeWeights.emplace_back(norm);
+      } else {
+        // We exceeded the tolerance
+        if (!pulsetimes.empty()) {
+          // Create a new event with the average TOF and summed weights and
+          // squared errors. 1 event used doesn't need to average
+          if (pulsetimes.size() == 1) {
+            writer.write(lastTof, pulsetimes.front(), weight, errorSquared);
+          } else {
+            writer.write(totalTof / tofNormalization,
+                         Kernel::DateAndTimeHelpers::averageSorted(pulsetimes, pulsetimeWeights), weight,
+                         errorSquared);
+          }
+        }
+        if (eventPulseBin != lastPulseBin)
+          // reset the bin_end for the new pulse bin
+          bin_end = tof_min;
+
+        // Start a new combined object
+        double norm = calcNorm(it->errorSquared());
+        totalTof = it->m_tof * norm;
+        weight = it->weight();
+        errorSquared = it->errorSquared();
+        tofNormalization = norm;
+        lastTof = it->m_tof;
+        lastPulseBin = eventPulseBin;
+        pulsetimes.clear();
+        pulsetimes.emplace_back(it->m_pulsetime);
+        pulsetimeWeights.clear();
+        pulsetimeWeights.emplace_back(norm);
+
+        bin_end = groups.next(lastTof, bin_end);
+      }
+    }
 
-  double bin_end = lastTof;
-  double tof_min{0};
-  std::function<bool(const double, const double)> compareTof;
-  std::function<double(const double, double)> next_bin;
+    // Put the last event in there too.
+    if (!pulsetimes.empty()) {
+      // Create a new event with the average TOF and summed weights and
+      // squared errors. 1 event used doesn't need to average
+      if (pulsetimes.size() == 1) {
+        writer.write(lastTof, pulsetimes.front(), weight, errorSquared);
+      } else {
+        writer.write(totalTof / tofNormalization,
+                     Kernel::DateAndTimeHelpers::averageSorted(pulsetimes, pulsetimeWeights), weight, errorSquared);
+      }
+    }
+    writer.finish();
+  };
 
   if (tolerance < 0) { // log
-    // for log we do "less than" so that is matches the log binning of the Rebin algorithm
-    compareTof = [](const double lhs, const double rhs) { return lhs < rhs; };
-    next_bin = [tolerance](const double lastTof, double bin_end) {
-      // advance the bin_end until we find the one that this next event falls into
-      while (lastTof >= bin_end)
-        bin_end = bin_end * (1 - tolerance);
-      return bin_end;
-    };
-
     // get minimum Tof so that binning is consistent across all pulses
     const auto event_min = std::min_element(
         events.cbegin(), events.cend(), [](const auto &left, const auto &right) { return left.tof() < right.tof(); });
-    bin_end = tof_min = event_min->tof();
+    const double tof_min = event_min->tof();
 
     if (tof_min < 0)
       throw std::runtime_error("compressEvents with log binning doesn't work with negative TOF");
 
     // can't start at 0 as this will create an infinite loop
-    if (tof_min == 0)
-      bin_end = tof_min = fabs(tolerance);
-
+    compress(LogTofGroups{tolerance}, tof_min == 0 ? fabs(tolerance) : tof_min);
   } else { // linear
-    // for linear we do "less than or equals" because that is how it was originally implemented
-    compareTof = [](const double lhs, const double rhs) { return lhs <= rhs; };
-    next_bin = [tolerance](const double lastTof, double) { return lastTof + tolerance; };
-  }
-
-  // get first bin_end
-  bin_end = next_bin(lastTof, bin_end);
-
-  // loop through events and accumulate weight
-  for (; it != events.cend(); ++it) {
-    const int64_t eventPulseBin = (it->m_pulsetime.totalNanoseconds() - pulsetimeStart) / pulsetimeDelta;
-    if ((eventPulseBin <= lastPulseBin) && compareTof(it->m_tof, bin_end)) {
-      // Carry the error and weight
-      weight += it->weight();
-      errorSquared += it->errorSquared();
-      double norm = calcNorm(it->errorSquared());
-      tofNormalization += norm;
-      // Track the average tof
-      totalTof += it->m_tof * norm;
-      // Accumulate the pulse times
-      pulsetimes.emplace_back(it->m_pulsetime);
-      pulsetimeWeights.emplace_back(norm);
-    } else {
-      // We exceeded the tolerance
-      if (!pulsetimes.empty()) {
-        // Create a new event with the average TOF and summed weights and
-        // squared errors. 1 event used doesn't need to average
-        if (pulsetimes.size() == 1) {
-          out.emplace_back(lastTof, pulsetimes.front(), weight, errorSquared);
-        } else {
-          out.emplace_back(totalTof / tofNormalization,
-                           Kernel::DateAndTimeHelpers::averageSorted(pulsetimes, pulsetimeWeights), weight,
-                           errorSquared);
-        }
-      }
-      if (tolerance < 0 && eventPulseBin != lastPulseBin)
-        // reset the bin_end for the new pulse bin
-        bin_end = tof_min;
-
-      // Start a new combined object
-      double norm = calcNorm(it->errorSquared());
-      totalTof = it->m_tof * norm;
-      weight = it->weight();
-      errorSquared = it->errorSquared();
-      tofNormalization = norm;
-      lastTof = it->m_tof;
-      lastPulseBin = eventPulseBin;
-      pulsetimes.clear();
-      pulsetimes.emplace_back(it->m_pulsetime);
-      pulsetimeWeights.clear();
-      pulsetimeWeights.emplace_back(norm);
-
-      bin_end = next_bin(lastTof, bin_end);
-    }
-  }
-
-  // Put the last event in there too.
-  if (!pulsetimes.empty()) {
-    // Create a new event with the average TOF and summed weights and
-    // squared errors. 1 event used doesn't need to average
-    if (pulsetimes.size() == 1) {
-      out.emplace_back(lastTof, pulsetimes.front(), weight, errorSquared);
-    } else {
-      out.emplace_back(totalTof / tofNormalization,
-                       Kernel::DateAndTimeHelpers::averageSorted(pulsetimes, pulsetimeWeights), weight, errorSquared);
-    }
-  }
-
-  // If you have over-allocated by more than 5%, reduce the size.
-  size_t excess_limit = out.size() / 20;
-  if ((out.capacity() - out.size()) > excess_limit) {
-    out.shrink_to_fit();
+    // the linear group ends only depend on the previous event so there is nothing to reset
+    compress(LinearTofGroups{tolerance}, events.front().m_tof);
   }
 }
 
@@ -1857,16 +1928,8 @@ void EventList::compressEvents(double tolerance, EventList *destination) {
 
     case WEIGHTED_NOTIME:
       if (destination == this) {
-        // Put results in a temp output
-        auto out = std::make_unique<std::vector<WeightedEventNoTime>>();
-        //        if (parallel)
-        //          compressEventsParallelHelper(this->weightedEventsNoTime,
-        //          out,
-        //          tolerance);
-        //        else
-        compressEventsHelper(*this->weightedEventsNoTime, *out, tolerance);
-        // Put it back
-        this->weightedEventsNoTime.swap(out);
+        // Compress in place, the output never overtakes the events still to be read
+        compressEventsHelper(*this->weightedEventsNoTime, *this->weightedEventsNoTime, tolerance);
       } else {
         //        if (parallel)
         //          compressEventsParallelHelper(this->weightedEventsNoTime,
@@ -2004,11 +2067,8 @@ void EventList::compressFatEvents(const double tolerance, const Mantid::Types::C
     case WEIGHTED:
       this->sortPulseTimeTOFDelta(timeStart, seconds);
       if (destination == this) {
-        // Put results in a temp output
-        auto out = std::make_unique<std::vector<WeightedEvent>>();
-        compressFatEventsHelper(*this->weightedEvents, *out, tolerance, timeStart, seconds);
-        // Put it back
-        this->weightedEvents.swap(out);
+        // Compress in place, the output never overtakes the events still to be read
+        compressFatEventsHelper(*this->weightedEvents, *this->weightedEvents, tolerance, timeStart, seconds);
       } else {
         destination->weightedEvents = std::make_unique<std::vector<WeightedEvent>>();
         compressFatEventsHelper(*this->weightedEvents, *destination->weightedEvents, tolerance, timeStart, seconds);
@@ -2148,7 +2208,7 @@ void EventList::histogramForWeightsHelper(const std::vector<T> &events, std::spa
   // Do we even have any events to do?
   if (!events.empty()) {
     // Iterate through all events (sorted by tof)
-    auto itev = findFirstEvent(events, T(X[0]));
+    auto itev = std::lower_bound(events.cbegin(), events.cend(), X[0]);
     auto itev_end = events.cend();
     // The above can still take you to end() if no events above X[0], so check
     // again.
@@ -2594,19 +2654,16 @@ void EventList::generateCountsHistogram(std::span<double const> X, MantidVec &Y)
 
   // Do we even have any events to do?
   if (!this->events->empty()) {
-    // Iterate through all events (sorted by tof) placing them in the correct
-    // bin.
-    auto itev = findFirstEvent(*this->events, TofEvent(X[0]));
-    const auto itend = this->events->end();
-    // Go through all the events,
-    for (auto itx = X.begin(); itev != itend; ++itev) {
-      const double tof = itev->tof();
-      itx = std::find_if(itx, X.end(), [tof](const double x) { return tof < x; });
-      if (itx == X.end()) {
-        break;
-      }
-      const auto bin = static_cast<size_t>(std::max(std::distance(X.begin(), itx) - 1, std::ptrdiff_t{0}));
-      ++Y[bin];
+    // The events are sorted by tof, so the counts in a bin are the distance
+    // between the first events at or above each of its edges. Each edge is
+    // searched for forwards from the previous one, so a bin of n events costs
+    // O(log n) and coarse binning does not visit every event.
+    const auto itend = this->events->cend();
+    auto lower = std::lower_bound(this->events->cbegin(), itend, X[0]);
+    for (size_t bin = 0; bin < x_size - 1; ++bin) {
+      const auto upper = gallopingLowerBound(lower, itend, X[bin + 1]);
+      Y[bin] = static_cast<double>(std::distance(lower, upper));
+      lower = upper;
     }
   } // end if (there are any events to histogram)
 }
@@ -3116,6 +3173,43 @@ void EventList::maskTof(const double tofMin, const double tofMax) {
     this->clear(false);
 }
 
+// --------------------------------------------------------------------------
+/** Remove the events that have a tof outside of tofMin and tofMax (inclusively).
+ * @param events :: reference to a vector of events to change.
+ * @param tofMin :: lowest tof to keep
+ * @param tofMax :: highest tof to keep
+ */
+template <class T> void EventList::cropTofHelper(std::vector<T> &events, const double tofMin, const double tofMax) {
+  events.erase(std::remove_if(events.begin(), events.end(),
+                              [tofMin, tofMax](const T &event) {
+                                const double tof = event.tof();
+                                return bool(tof < tofMin || tof > tofMax);
+                              }),
+               events.end());
+}
+
+// --------------------------------------------------------------------------
+/**
+ * Remove the events that have a tof outside of tofMin and tofMax (inclusively).
+ * This looks at every event rather than sorting first, so it is cheaper than
+ * maskTof on unsorted lists, and it keeps the order of the remaining events.
+ * @param tofMin :: lowest tof to keep
+ * @param tofMax :: highest tof to keep
+ */
+void EventList::cropTof(const double tofMin, const double tofMax) {
+  switch (eventType) {
+  case TOF:
+    cropTofHelper(*this->events, tofMin, tofMax);
+    break;
+  case WEIGHTED:
+    cropTofHelper(*this->weightedEvents, tofMin, tofMax);
+    break;
+  case WEIGHTED_NOTIME:
+    cropTofHelper(*this->weightedEventsNoTime, tofMin, tofMax);
+    break;
+  }
+}
+
 // --------------------------------------------------------------------------
 /** Mask out events by the condition vector.
  * Events are removed from the list.
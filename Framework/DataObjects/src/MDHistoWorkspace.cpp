@@ -17,6 +17,7 @@
 #include "MantidKernel/VMD.h"
 #include "MantidKernel/WarningSuppressions.h"
 
+#include <algorithm>
 #include <boost/scoped_array.hpp>
 #include <cmath>
 #include <map>
@@ -28,6 +29,27 @@ using namespace Mantid::Geometry;
 using namespace Mantid::API;
 
 namespace Mantid::DataObjects {
+
+namespace {
+/** Copy an array into a freshly allocated, zero-filled one of the same size,
+ * skipping page-sized blocks that hold only +0.0 so that the destination
+ * pages behind them are never committed.
+ */
+template <typename Array> void copyNonZeroBlocks(const Array &source, Array &destination) {
+  using value_type = typename Array::value_type;
+  constexpr size_t blockSize = 4096 / sizeof(value_type);
+  const auto isNonZero = [](const value_type value) { return value != 0 || std::signbit(value); };
+  const auto *src = source.data();
+  auto *dest = destination.data();
+  const size_t length = source.size();
+  for (size_t start = 0; start < length; start += blockSize) {
+    const size_t end = std::min(start + blockSize, length);
+    if (std::any_of(src + start, src + end, isNonZero))
+      std::copy(src + start, src + end, dest + start);
+  }
+}
+} // namespace
+
 //----------------------------------------------------------------------------------------------
 /** Constructor given the 4 dimensions
  * @param dimX :: X dimension binning parameters
@@ -61,12 +83,14 @@ MDHistoWorkspace::MDHistoWorkspace(Mantid::Geometry::MDHistoDimension_sptr dimX,
  * @param dimensions :: vector of MDHistoDimension; no limit to how many.
  * @param displayNormalization :: optional display normalization to use as the
  * default.
+ * @param zeroInitialise :: if true the bins start at zero instead of NaN and no
+ * memory is committed for them until they are written.
  */
 MDHistoWorkspace::MDHistoWorkspace(std::vector<Mantid::Geometry::MDHistoDimension_sptr> &dimensions,
-                                   Mantid::API::MDNormalization displayNormalization)
+                                   Mantid::API::MDNormalization displayNormalization, bool zeroInitialise)
     : IMDHistoWorkspace(), numDimensions(0), m_nEventsContributed(std::numeric_limits<uint64_t>::quiet_NaN()),
       m_coordSystem(None), m_displayNormalization(displayNormalization) {
-  this->init(dimensions);
+  this->init(dimensions, zeroInitialise);
 }
 
 //----------------------------------------------------------------------------------------------
@@ -74,12 +98,14 @@ MDHistoWorkspace::MDHistoWorkspace(std::vector<Mantid::Geometry::MDHistoDimensio
  * @param dimensions :: vector of MDHistoDimension; no limit to how many.
  * @param displayNormalization :: optional display normalization to use as the
  * default.
+ * @param zeroInitialise :: if true the bins start at zero instead of NaN and no
+ * memory is committed for them until they are written.
  */
 MDHistoWorkspace::MDHistoWorkspace(std::vector<Mantid::Geometry::IMDDimension_sptr> const &dimensions,
-                                   Mantid::API::MDNormalization displayNormalization)
+                                   Mantid::API::MDNormalization displayNormalization, bool zeroInitialise)
     : IMDHistoWorkspace(), numDimensions(0), m_nEventsContributed(std::numeric_limits<uint64_t>::quiet_NaN()),
       m_coordSystem(None), m_displayNormalization(displayNormalization) {
-  this->init(dimensions);
+  this->init(dimensions, zeroInitialise);
 }
 
 //----------------------------------------------------------------------------------------------
@@ -93,46 +119,53 @@ MDHistoWorkspace::MDHistoWorkspace(const MDHistoWorkspace &other)
   // Dimensions are copied by the copy constructor of MDGeometry
   this->cacheValues();
   // Allocate the linear arrays
-  m_signals = std::vector<signal_t>(m_length);
-  m_errorsSquared = std::vector<signal_t>(m_length);
-  m_numEvents = std::vector<signal_t>(m_length);
+  m_signals = SignalArray(m_length);
+  m_errorsSquared = SignalArray(m_length);
+  m_numEvents = SignalArray(m_length);
   m_masks = std::make_unique<bool[]>(m_length);
-  // Now copy all the data
-  std::copy_n(other.m_signals.begin(), m_length, m_signals.begin());
-  std::copy_n(other.m_errorsSquared.begin(), m_length, m_errorsSquared.begin());
-  std::copy_n(other.m_numEvents.begin(), m_length, m_numEvents.begin());
+  // Now copy all the data, leaving empty regions of the source uncommitted
+  copyNonZeroBlocks(other.m_signals, m_signals);
+  copyNonZeroBlocks(other.m_errorsSquared, m_errorsSquared);
+  copyNonZeroBlocks(other.m_numEvents, m_numEvents);
   std::copy_n(other.m_masks.get(), m_length, m_masks.get());
 }
 
 //----------------------------------------------------------------------------------------------
 /** Constructor helper method
  * @param dimensions :: vector of MDHistoDimension; no limit to how many.
+ * @param zeroInitialise :: if true the bins are left at zero instead of NaN.
  */
-void MDHistoWorkspace::init(std::vector<Mantid::Geometry::MDHistoDimension_sptr> &dimensions) {
+void MDHistoWorkspace::init(std::vector<Mantid::Geometry::MDHistoDimension_sptr> &dimensions,
+                            const bool zeroInitialise) {
   std::vector<IMDDimension_sptr> dim2;
   dim2.reserve(dimensions.size());
   std::transform(dimensions.cbegin(), dimensions.cend(), std::back_inserter(dim2),
                  [](const auto dimension) { return std::dynamic_pointer_cast<IMDDimension>(dimension); });
-  this->init(dim2);
+  this->init(dim2, zeroInitialise);
   m_nEventsContributed = 0;
 }
 
 //----------------------------------------------------------------------------------------------
 /** Constructor helper method
  * @param dimensions :: vector of IMDDimension; no limit to how many.
+ * @param zeroInitialise :: if true the bins are left at zero instead of NaN.
  */
-void MDHistoWorkspace::init(std::vector<Mantid::Geometry::IMDDimension_sptr> const &dimensions) {
+void MDHistoWorkspace::init(std::vector<Mantid::Geometry::IMDDimension_sptr> const &dimensions,
+                            const bool zeroInitialise) {
   MDGeometry::initGeometry(dimensions);
   this->cacheValues();
 
-  // Allocate the linear arrays
-  m_signals = std::vector<signal_t>(m_length);
-  m_errorsSquared = std::vector<signal_t>(m_length);
-  m_numEvents = std::vector<signal_t>(m_length);
+  // Allocate the linear arrays. They start out zeroed and their memory is only
+  // committed once written to.
+  m_signals = SignalArray(m_length);
+  m_errorsSquared = SignalArray(m_length);
+  m_numEvents = SignalArray(m_length);
   m_masks = std::make_unique<bool[]>(m_length);
-  // Initialize them to NAN (quickly)
-  signal_t nan = std::numeric_limits<signal_t>::quiet_NaN();
-  this->setTo(nan, nan, nan);
+  if (!zeroInitialise) {
+    // Initialize them to NAN (quickly)
+    signal_t nan = std::numeric_limits<signal_t>::quiet_NaN();
+    this->setTo(nan, nan, nan);
+  }
   m_nEventsContributed = 0;
 }
 
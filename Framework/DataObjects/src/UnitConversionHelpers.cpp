@@ -0,0 +1,76 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidDataObjects/UnitConversionHelpers.h"
+#include "MantidAPI/MatrixWorkspace.h"
+#include "MantidAPI/SpectrumInfo.h"
+#include "MantidDataObjects/EventList.h"
+#include "MantidGeometry/Instrument.h"
+#include "MantidKernel/Unit.h"
+
+#include <algorithm>
+#include <memory>
+
+namespace Mantid::DataObjects {
+
+using namespace Kernel;
+
+/** Reads the instrument's "show-signed-theta" parameter
+ * @param workspace :: the workspace whose instrument is checked
+ * @return true if scattering angles should keep their sign
+ */
+bool UnitConversionHelpers::useSignedTheta(const API::MatrixWorkspace &workspace) {
+  const auto parameters = workspace.getInstrument()->getStringParameter("show-signed-theta");
+  return std::find(parameters.cbegin(), parameters.cend(), "Always") != parameters.cend();
+}
+
+/** Converts the x-axis of one spectrum from one unit to another via time-of-flight and, if the spectrum is an
+ * EventList, its events too. Spectra whose detector values cannot be calculated have their data cleared and are
+ * masked if they have detectors. Safe to call for different spectra from several threads.
+ * @param workspace :: the workspace holding the spectrum, modified in place
+ * @param spectrumInfo :: the workspace's mutable spectrum info
+ * @param index :: the workspace index of the spectrum
+ * @param fromUnit :: the current unit of the spectrum
+ * @param toUnit :: the unit to convert to
+ * @param l1 :: the source-sample distance
+ * @param emode :: the energy mode
+ * @param signedTheta :: whether scattering angles keep their sign
+ * @param efixed :: the fixed energy, or EMPTY_DBL() if there is none
+ * @return false if the spectrum could not be converted and was cleared
+ */
+bool UnitConversionHelpers::convertSpectrumViaTOF(API::MatrixWorkspace &workspace, API::SpectrumInfo &spectrumInfo,
+                                                  const size_t index, const Unit &fromUnit, const Unit &toUnit,
+                                                  const double l1, const DeltaEMode::Type emode,
+                                                  const bool signedTheta, const double efixed) {
+  // the units cache their parameters in toTOF/fromTOF so each call needs its own
+  auto localFromUnit = std::unique_ptr<Unit>(fromUnit.clone());
+  auto localToUnit = std::unique_ptr<Unit>(toUnit.clone());
+
+  /// @todo Don't yet consider hold-off (delta)
+  UnitParametersMap pmap = {{UnitParams::delta, 0.0}};
+  if (efixed != EMPTY_DBL()) {
+    pmap[UnitParams::efixed] = efixed;
+  }
+  spectrumInfo.getDetectorValues(fromUnit, toUnit, emode, signedTheta, index, pmap);
+  try {
+    auto &xValues = workspace.mutableX(index);
+    localFromUnit->toTOF(xValues.begin(), xValues.end(), l1, emode, pmap);
+    localToUnit->fromTOF(xValues.begin(), xValues.end(), l1, emode, pmap);
+
+    if (auto *events = dynamic_cast<EventList *>(&workspace.getSpectrum(index))) {
+      events->convertUnitsViaTof(localFromUnit.get(), localToUnit.get());
+    }
+  } catch (std::runtime_error &) {
+    // Usually there are no attached detectors, so this is the same as zeroing the data
+    workspace.getSpectrum(index).clearData();
+    if (spectrumInfo.hasDetectors(index))
+      spectrumInfo.setMasked(index, true);
+    return false;
+  }
+  return true;
+}
+
+} // namespace Mantid::DataObjects
@@ -21,6 +21,7 @@
 
 #include <boost/scoped_ptr.hpp>
 #include <cmath>
+#include <numeric>
 
 using namespace Mantid;
 using namespace Mantid::API;
@@ -1227,6 +1228,31 @@ public:
     }
   }
 
+  void test_histogram_sorted_matches_counting_each_event() {
+    // clusters of events on and between the bin edges, and outside the range
+    EventList sorted;
+    for (int i = 0; i < 200; ++i) {
+      sorted += TofEvent(static_cast<double>(i % 50) * 2.0 - 10.0);
+      sorted += TofEvent(static_cast<double>(i % 7) * 0.5 + 30.0);
+    }
+    sorted += TofEvent(90.0);
+    const std::vector<std::vector<double>> binnings{{0., 1., 2., 30., 30.5, 33., 90.}, {-100., 100.},
+                                                    {31., 31.1, 31.2}, {100., 200.}, {0., 10., 20., 40., 60., 80.}};
+    for (const auto &X : binnings) {
+      MantidVec Y, E;
+      sorted.generateHistogram(X, Y, E);
+      TS_ASSERT_EQUALS(Y.size(), X.size() - 1);
+      for (size_t bin = 0; bin < Y.size(); ++bin) {
+        const auto &events = sorted.getEvents();
+        const auto expected = std::count_if(events.cbegin(), events.cend(), [&X, bin](const TofEvent &event) {
+          return event.tof() >= X[bin] && event.tof() < X[bin + 1];
+        });
+        TS_ASSERT_EQUALS(Y[bin], static_cast<double>(expected));
+        TS_ASSERT_DELTA(E[bin], std::sqrt(static_cast<double>(expected)), 1e-12);
+      }
+    }
+  }
+
   void test_random_histogram() {
     this->fake_data();
     this->test_setX();
@@ -1338,6 +1364,24 @@ public:
     }
   }
 
+  //-----------------------------------------------------------------------------------------------
+  void test_cropTof_allTypes() {
+    // Go through each possible EventType as the input
+    for (int this_type = 0; this_type < 3; this_type++) {
+      this->fake_uniform_data();
+      el.switchTo(static_cast<EventType>(this_type));
+      TS_ASSERT_EQUALS(el.getNumberEvents(), 2 * MAX_TOF / BIN_DELTA);
+      // Keep only 5-10 milliseconds, the complement of test_maskTof_allTypes
+      double min = MAX_TOF * 0.25;
+      double max = MAX_TOF * 0.5;
+      el.cropTof(min, max);
+      for (std::size_t i = 0; i < el.getNumberEvents(); i++) {
+        TS_ASSERT((el.getEvent(i).tof() >= min) && (el.getEvent(i).tof() <= max));
+      }
+      TS_ASSERT_EQUALS(el.getNumberEvents(), 0.25 * 2 * MAX_TOF / BIN_DELTA);
+    }
+  }
+
   //-----------------------------------------------------------------------------------------------
   void test_maskCondition_allTypes() {
     // Go through each possible EventType as the input
@@ -2075,6 +2119,35 @@ public:
     TS_ASSERT_DIFFERS(uniformOut, varyingOut);
   }
 
+  void test_compressFatEvents_InPlace_matches_copy() {
+    for (const double tolerance : {10000., -0.01}) {
+      this->fake_uniform_data_changing_weights();
+      EventList inPlace(el);
+      EventList copied;
+      TS_ASSERT_THROWS_NOTHING(el.compressFatEvents(tolerance, el.getPulseTimeMin(), 30., &copied));
+      TS_ASSERT_THROWS_NOTHING(inPlace.compressFatEvents(tolerance, inPlace.getPulseTimeMin(), 30., &inPlace));
+      TS_ASSERT_EQUALS(inPlace, copied);
+      // the consumed input is released
+      const size_t numEvents = inPlace.getNumberEvents();
+      TS_ASSERT_LESS_THAN_EQUALS(inPlace.getWeightedEvents().capacity(), numEvents + numEvents / 20);
+    }
+  }
+
+  void test_compressEvents_WeightedNoTime_InPlace_matches_copy() {
+    for (const double tolerance : {10000., -0.01}) {
+      this->fake_uniform_data_changing_weights();
+      el.switchTo(WEIGHTED_NOTIME);
+      EventList inPlace(el);
+      EventList copied;
+      TS_ASSERT_THROWS_NOTHING(el.compressEvents(tolerance, &copied));
+      TS_ASSERT_THROWS_NOTHING(inPlace.compressEvents(tolerance, &inPlace));
+      TS_ASSERT_EQUALS(inPlace.getEventType(), WEIGHTED_NOTIME);
+      TS_ASSERT(inPlace.isSortedByTof());
+      TS_ASSERT_LESS_THAN(inPlace.getNumberEvents(), el.getNumberEvents());
+      TS_ASSERT_EQUALS(inPlace, copied);
+    }
+  }
+
   void test_getEventsFrom() {
     std::vector<TofEvent> *rel;
     TS_ASSERT_THROWS_NOTHING(getEventsFrom(el, rel));
@@ -3097,6 +3170,17 @@ public:
     el_sorted_weighted.generateHistogram(coarseX, Y, E);
   }
 
+  void test_histogram_repeated_rebinning() {
+    // once sorted, a coarse histogram only searches for the bin edges
+    MantidVec Y, E;
+    for (size_t i = 0; i < 1000; ++i)
+      el_sorted.generateHistogram(coarseX, Y, E);
+    // one event every 0.01 and the bins are 100 wide, up to the last edge at 99900
+    TS_ASSERT_EQUALS(Y.size(), coarseX.size() - 1);
+    TS_ASSERT_EQUALS(Y.front(), 10000.);
+    TS_ASSERT_EQUALS(std::accumulate(Y.cbegin(), Y.cend(), 0.), 9990000.);
+  }
+
   void test_maskTof() {
     TS_ASSERT_EQUALS(el_sorted.getNumberEvents(), 10000000);
     el_sorted.maskTof(25e3, 75e3);
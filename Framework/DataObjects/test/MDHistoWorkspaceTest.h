@@ -250,6 +250,54 @@ public:
     AnalysisDataService::Instance().clear();
   }
 
+  //--------------------------------------------------------------------------------------
+  void test_constructor_zeroInitialise() {
+    Mantid::Geometry::GeneralFrame frame("m", "m");
+    std::vector<MDHistoDimension_sptr> dimensions{
+        std::make_shared<MDHistoDimension>("X", "x", frame, -10.f, 10.f, 50),
+        std::make_shared<MDHistoDimension>("Y", "y", frame, -10.f, 10.f, 50)};
+
+    MDHistoWorkspace ws(dimensions, NoNormalization, true);
+
+    TS_ASSERT_EQUALS(ws.getNPoints(), 50 * 50);
+    TS_ASSERT_EQUALS(ws.getNEvents(), 0);
+    for (size_t i = 0; i < ws.getNPoints(); i++) {
+      TS_ASSERT_EQUALS(ws.getSignalAt(i), 0.0);
+      TS_ASSERT_EQUALS(ws.getErrorAt(i), 0.0);
+      TS_ASSERT_EQUALS(ws.getNumEventsAt(i), 0.0);
+      TS_ASSERT(!ws.getIsMaskedAt(i));
+    }
+  }
+
+  //--------------------------------------------------------------------------------------
+  void test_copy_constructor_of_sparse_workspace() {
+    Mantid::Geometry::GeneralFrame frame("m", "m");
+    std::vector<MDHistoDimension_sptr> dimensions{
+        std::make_shared<MDHistoDimension>("X", "x", frame, -10.f, 10.f, 100),
+        std::make_shared<MDHistoDimension>("Y", "y", frame, -10.f, 10.f, 100),
+        std::make_shared<MDHistoDimension>("Z", "z", frame, -10.f, 10.f, 10)};
+    MDHistoWorkspace a(dimensions, NoNormalization, true);
+    // Only a few bins scattered over the arrays are filled
+    a.setSignalAt(7, 1.5);
+    a.setErrorSquaredAt(7, 2.25);
+    a.setNumEventsAt(7, 3.);
+    a.setSignalAt(51234, -0.0);
+    a.setSignalAt(99999, std::numeric_limits<double>::quiet_NaN());
+
+    TestableMDHistoWorkspace b(a);
+
+    TS_ASSERT_EQUALS(b.getNPoints(), a.getNPoints());
+    for (size_t i = 0; i < a.getNPoints(); i++) {
+      if (std::isnan(a.getSignalAt(i)))
+        TS_ASSERT(std::isnan(b.getSignalAt(i)))
+      else
+        TS_ASSERT_EQUALS(b.getSignalAt(i), a.getSignalAt(i))
+      TS_ASSERT_EQUALS(b.getErrorAt(i), a.getErrorAt(i))
+      TS_ASSERT_EQUALS(b.getNumEventsAt(i), a.getNumEventsAt(i))
+    }
+    TS_ASSERT(std::signbit(b.getSignalAt(51234)));
+  }
+
   //--------------------------------------------------------------------------------------
   void test_array_operator() {
     MDHistoWorkspace_sptr a = MDEventsTestHelper::makeFakeMDHistoWorkspace(1.23, 2, 5, 10.0, 3.234);
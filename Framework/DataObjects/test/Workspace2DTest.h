@@ -61,6 +61,19 @@ public:
     ws.swap(cloned);
   }
 
+  void testCloneSharesDataUntilModified() {
+    Workspace2D_sptr cloned(ws->clone());
+    // the histograms of a workspace are stored next to each other
+    TS_ASSERT_EQUALS(&cloned->getSpectrum(1), &cloned->getSpectrum(0) + 1);
+
+    TS_ASSERT_EQUALS(&cloned->y(0), &ws->y(0));
+    TS_ASSERT_EQUALS(&cloned->e(0), &ws->e(0));
+    cloned->mutableY(0)[0] = 42.;
+    TS_ASSERT_DIFFERS(&cloned->y(0), &ws->y(0));
+    TS_ASSERT_DIFFERS(ws->y(0)[0], 42.);
+    TS_ASSERT_EQUALS(&cloned->e(0), &ws->e(0));
+  }
+
   void testInit() {
     ws->setTitle("testInit");
     TS_ASSERT_EQUALS(ws->getNumberHistograms(), nhist);
@@ -1176,6 +1176,16 @@ public:
     BinEdges edges(histSize, LinearGenerator(0, 2));
     for (size_t i = 0; i < nHists; i++)
       hists.emplace_back(Histogram(edges));
+    BinEdges countEdges(countsSize + 1, LinearGenerator(0, 2));
+    for (size_t i = 0; i < nCountHists; i++)
+      countHists.emplace_back(Histogram(countEdges, Counts(countsSize, 1.0)));
+  }
+
+  void test_mutableY_in_tight_loop() {
+    // every call checks whether Y is shared, which must not lock
+    for (auto &hist : countHists)
+      for (size_t i = 0; i < countsSize; ++i)
+        hist.mutableY()[i] += 1.0;
   }
 
   void test_copy_X() {
@@ -1200,4 +1210,7 @@ private:
   const size_t histSize = 4000;
   std::vector<Histogram> hists;
   HistogramX xData;
+  const size_t nCountHists = 10000;
+  const size_t countsSize = 1000;
+  std::vector<Histogram> countHists;
 };
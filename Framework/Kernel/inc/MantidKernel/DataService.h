@@ -18,6 +18,7 @@
 #include <Poco/Notification.h>
 #include <Poco/NotificationCenter.h>
 #include <mutex>
+#include <shared_mutex>
 
 #ifdef _WIN32
 #define strcasecmp _stricmp
@@ -193,7 +194,7 @@ public:
     bool success = false;
     {
       // Make DataService access thread-safe
-      std::lock_guard<std::recursive_mutex> lock(m_mutex);
+      std::lock_guard<std::shared_mutex> lock(m_mutex);
       // At the moment, you can't overwrite an object (i.e. pass in a name
       // that's already in the map with a pointer to a different object).
       // Also, there's nothing to stop the same object from being added
@@ -222,7 +223,7 @@ public:
     checkForNullPointer(Tobject);
 
     // Make DataService access thread-safe
-    std::unique_lock<std::recursive_mutex> lock(m_mutex);
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
 
     // find if the Tobject already exists
     auto it = datamap.find(name);
@@ -249,7 +250,7 @@ public:
    * @param name :: name of the object */
   void remove(const std::string &name) {
     // Make DataService access thread-safe
-    std::unique_lock<std::recursive_mutex> lock(m_mutex);
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
 
     auto it = datamap.find(name);
     if (it == datamap.end()) {
@@ -289,7 +290,7 @@ public:
       caseInsensitiveMatch = true;
     }
     // Make DataService access thread-safe
-    std::unique_lock<std::recursive_mutex> lock(m_mutex);
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
 
     auto existingNameIter = datamap.find(oldName);
     if (existingNameIter == datamap.end()) {
@@ -336,7 +337,7 @@ public:
   void clear() {
     {
       // Make DataService access thread-safe
-      std::lock_guard<std::recursive_mutex> lock(m_mutex);
+      std::lock_guard<std::shared_mutex> lock(m_mutex);
       datamap.clear();
     }
     notificationCenter.postNotification(new ClearNotification());
@@ -351,7 +352,7 @@ public:
    * @param name :: name of the object */
   std::shared_ptr<T> retrieve(const std::string &name) const {
     // Make DataService access thread-safe
-    std::lock_guard<std::recursive_mutex> _lock(m_mutex);
+    std::shared_lock<std::shared_mutex> _lock(m_mutex);
 
     auto it = datamap.find(name);
     if (it != datamap.end()) {
@@ -371,14 +372,14 @@ public:
   /// Check to see if a data object exists in the store
   bool doesExist(const std::string &name) const {
     // Make DataService access thread-safe
-    std::lock_guard<std::recursive_mutex> _lock(m_mutex);
+    std::shared_lock<std::shared_mutex> _lock(m_mutex);
     auto it = datamap.find(name);
     return it != datamap.end();
   }
 
   /// Return the number of objects stored by the data service
   size_t size() const {
-    std::lock_guard<std::recursive_mutex> _lock(m_mutex);
+    std::shared_lock<std::shared_mutex> _lock(m_mutex);
 
     if (showingHiddenObjects()) {
       return datamap.size();
@@ -415,7 +416,7 @@ public:
     // Use the scoping of an if to handle our lock for duration
     if (hiddenState == DataServiceHidden::Include) {
       // Getting hidden items
-      std::lock_guard<std::recursive_mutex> _lock(m_mutex);
+      std::shared_lock<std::shared_mutex> _lock(m_mutex);
       foundNames.reserve(datamap.size());
       for (const auto &item : datamap) {
         if (contain.empty()) {
@@ -426,7 +427,7 @@ public:
       }
       // Lock released at end of scope here
     } else {
-      std::lock_guard<std::recursive_mutex> _lock(m_mutex);
+      std::shared_lock<std::shared_mutex> _lock(m_mutex);
       foundNames.reserve(datamap.size());
       for (const auto &item : datamap) {
         if (!isHiddenDataServiceObject(item.first)) {
@@ -451,7 +452,7 @@ public:
 
   /// Get a vector of the pointers to the data objects stored by the service
   std::vector<std::shared_ptr<T>> getObjects(DataServiceHidden includeHidden = DataServiceHidden::Auto) const {
-    std::lock_guard<std::recursive_mutex> _lock(m_mutex);
+    std::shared_lock<std::shared_mutex> _lock(m_mutex);
 
     const bool alwaysIncludeHidden = includeHidden == DataServiceHidden::Include;
     const bool usingAuto = includeHidden == DataServiceHidden::Auto && showingHiddenObjects();
@@ -514,8 +515,9 @@ private:
   const std::string svcName;
   /// Map of objects in the data service
   svcmap datamap;
-  /// Recursive mutex to avoid simultaneous access or notifications
-  mutable std::recursive_mutex m_mutex;
+  /// Guards datamap. Lookups take it shared so that concurrent readers do not
+  /// serialise; it is never held while notifications are posted.
+  mutable std::shared_mutex m_mutex;
   /// Logger for this DataService
   Logger g_log;
 }; // End Class Data service
@@ -6,6 +6,7 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #pragma once
 
+#include "MantidKernel/DllConfig.h"
 #include "MultiThreaded.h"
 
 #ifndef Q_MOC_RUN
@@ -17,6 +18,11 @@
 
 namespace Mantid {
 namespace Kernel {
+namespace detail {
+/// Returns the mutex that serialises copying the data of the cow_ptr at the given address
+MANTID_KERNEL_DLL std::mutex &cowPtrCopyMutex(const void *owner) noexcept;
+} // namespace detail
+
 /**
   \class cow_ptr
   \brief Implements a copy on write data template
@@ -37,6 +43,11 @@ namespace Kernel {
   semantics but call the access function if the data is required
   to be modified.
 
+  A cow_ptr is the size of a std::shared_ptr. Modifying data that
+  is only referenced by one cow_ptr does not lock. Copying shared
+  data takes one of a small pool of mutexes, picked by the address
+  of the cow_ptr, rather than a mutex held by every instance.
+
 */
 template <typename DataType> class cow_ptr {
 public:
@@ -45,7 +56,6 @@ public:
 
 private:
   ptr_type Data; ///< Real object Ptr
-  std::mutex copyMutex;
 
 public:
   cow_ptr(ptr_type &&resourceSptr) noexcept;
@@ -55,14 +65,9 @@ public:
   /// Constructs a cow_ptr with no managed object, i.e. empty cow_ptr.
   constexpr cow_ptr(std::nullptr_t) noexcept : Data(nullptr) {}
   cow_ptr(const cow_ptr<DataType> &) noexcept;
-  // Move is hand-written, since std::mutex member prevents auto-generation.
-  cow_ptr(cow_ptr<DataType> &&other) noexcept : Data(std::move(other.Data)) {}
+  cow_ptr(cow_ptr<DataType> &&other) noexcept = default;
   cow_ptr<DataType> &operator=(const cow_ptr<DataType> &) noexcept;
-  // Move is hand-written, since std::mutex member prevents auto-generation.
-  cow_ptr<DataType> &operator=(cow_ptr<DataType> &&rhs) noexcept {
-    Data = std::move(rhs.Data);
-    return *this;
-  }
+  cow_ptr<DataType> &operator=(cow_ptr<DataType> &&rhs) noexcept = default;
   cow_ptr<DataType> &operator=(const ptr_type &) noexcept;
 
   /// Returns the stored pointer.
@@ -101,7 +106,6 @@ template <typename DataType> cow_ptr<DataType>::cow_ptr() : Data(std::make_share
   Copy constructor : double references the data object
   @param A :: object to copy
 */
-// Note: Need custom implementation, since std::mutex is not copyable.
 template <typename DataType>
 cow_ptr<DataType>::cow_ptr(const cow_ptr<DataType> &A) noexcept : Data(std::atomic_load(&A.Data)) {}
 
@@ -111,7 +115,6 @@ cow_ptr<DataType>::cow_ptr(const cow_ptr<DataType> &A) noexcept : Data(std::atom
   @param A :: object to copy
   @return *this
 */
-// Note: Need custom implementation, since std::mutex is not copyable.
 template <typename DataType> cow_ptr<DataType> &cow_ptr<DataType>::operator=(const cow_ptr<DataType> &A) noexcept {
   if (this != &A) {
     std::atomic_store(&Data, std::atomic_load(&A.Data));
@@ -148,7 +151,7 @@ template <typename DataType> DataType &cow_ptr<DataType>::access() {
   // Use a double-check for sharing so that we only acquire the lock if
   // absolutely necessary
   if (Data.use_count() > 1) {
-    std::lock_guard<std::mutex> lock{copyMutex};
+    std::lock_guard<std::mutex> lock{detail::cowPtrCopyMutex(this)};
     // Check again because another thread may have taken copy and dropped
     // reference count since previous check
     if (Data.use_count() > 1) {
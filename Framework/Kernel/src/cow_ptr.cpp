@@ -0,0 +1,33 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidKernel/cow_ptr.h"
+
+#include <array>
+#include <cstdint>
+
+namespace Mantid::Kernel::detail {
+
+namespace {
+/// Number of mutexes shared by all cow_ptr instances. Copies are rare compared to
+/// reads so a small pool is enough to make contention unlikely.
+constexpr std::size_t NUM_COPY_MUTEXES{64};
+} // namespace
+
+/**
+ * The cow_ptr instances are spread over the pool by address, so concurrent copies
+ * of the same cow_ptr always take the same mutex.
+ * @param owner :: address of the cow_ptr whose data is being copied
+ * @return the mutex to hold while copying
+ */
+std::mutex &cowPtrCopyMutex(const void *owner) noexcept {
+  static std::array<std::mutex, NUM_COPY_MUTEXES> mutexes;
+  // the low bits are the same for every cow_ptr because of alignment
+  const auto address = reinterpret_cast<std::uintptr_t>(owner) / alignof(std::shared_ptr<void>);
+  return mutexes[address % NUM_COPY_MUTEXES];
+}
+
+} // namespace Mantid::Kernel::detail
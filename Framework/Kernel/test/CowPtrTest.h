@@ -6,9 +6,11 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #pragma once
 
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/cow_ptr.h"
 #include <cxxtest/TestSuite.h>
 #include <memory>
+#include <vector>
 
 using namespace Mantid::Kernel;
 
@@ -151,6 +153,28 @@ public:
     TSM_ASSERT_DIFFERS("Value should now have changed", original->value, copyResource.value);
   }
 
+  void test_size_is_that_of_a_shared_ptr() {
+    // there is no mutex per instance
+    TS_ASSERT_EQUALS(sizeof(cow_ptr<MyType>), sizeof(std::shared_ptr<MyType>));
+  }
+
+  void test_concurrent_access_of_shared_data() {
+    cow_ptr<MyType> original{std::make_shared<MyType>(-1)};
+    std::vector<cow_ptr<MyType>> copies(100, original);
+
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 0; i < static_cast<int>(copies.size()); ++i) {
+      copies[i].access().value = i;
+    }
+
+    TS_ASSERT_EQUALS(original->value, -1);
+    TS_ASSERT(original.unique());
+    for (int i = 0; i < static_cast<int>(copies.size()); ++i) {
+      TS_ASSERT_EQUALS(copies[i]->value, i);
+      TS_ASSERT(copies[i].unique());
+    }
+  }
+
   void test_equals_not_equals() {
     cow_ptr<MyType> cow{nullptr};
     TS_ASSERT(cow == cow);
@@ -12,6 +12,7 @@
 #include "MantidAPI/Algorithm.h"
 #include "MantidAPI/LiveListener.h"
 #include "MantidDataObjects/EventWorkspace.h"
+#include "MantidLiveData/DllConfig.h"
 #include <Poco/ActiveMethod.h>
 #include <Poco/Void.h>
 
@@ -26,8 +27,13 @@ namespace LiveData {
     via the ConfigService or included in Mantud.user.properties):
      - fileeventdatalistener.filename
      - fileeventdatalistener.chunks
+
+    Optionally, fileeventdatalistener.eventrate sets a sustained rate in events
+    per second at which the file is replayed: each chunk is held back until all
+    of its events would have arrived at that rate. This makes the listener
+    usable for reproducible throughput and latency measurements.
  */
-class FileEventDataListener : public API::LiveListener {
+class MANTID_LIVEDATA_DLL FileEventDataListener : public API::LiveListener {
 public:
   FileEventDataListener();
   ~FileEventDataListener() override;
@@ -45,6 +51,11 @@ public:
   Mantid::API::ListenerState listenerState() const override;
   int runNumber() const override;
 
+  /// Time at which the last chunk was due when replaying at a fixed rate
+  const Types::Core::DateAndTime &lastChunkDueTime() const { return m_lastChunkDueTime; }
+  /// Seconds by which the last extraction was behind the replay rate
+  double replayLag() const { return m_replayLag; }
+
 private:
   std::string m_filename;   ///< The file to read
   int m_runNumber;          ///< The number of the run in the file
@@ -57,9 +68,16 @@ private:
   bool m_canLoadMonitors;     ///< A flag to turn off monitor loading for loaders
   /// that can
 
+  double m_eventRate;                          ///< Replay rate in events/s, 0 for no limit
+  std::size_t m_eventsReplayed;                ///< Number of events handed out so far
+  Types::Core::DateAndTime m_replayStart;      ///< Start of the replay clock
+  Types::Core::DateAndTime m_lastChunkDueTime; ///< When the last chunk was due
+  double m_replayLag;                          ///< Seconds the last chunk was handed out late
+
   /// Future that holds the result of the latest call to LoadEventPreNexus
   std::unique_ptr<Poco::ActiveResult<bool>> m_chunkload;
   void loadChunk();
+  void waitForReplayTime(std::size_t numEvents);
   /// Shared pointer to the correct file loader instance - it needs to be kept
   /// alive.
   API::Algorithm_sptr m_loader;
@@ -77,6 +77,8 @@ private:
   /// m_localEvents
   std::vector<BufferedEvent> m_receivedEventBuffer;
   std::vector<BufferedPulse> m_receivedPulseBuffer;
+  /// Storage used to sort m_receivedEventBuffer by workspace index
+  std::vector<BufferedEvent> m_sortedEventBuffer;
   /// Mutex protecting intermediate buffers
   mutable std::mutex m_intermediateBufferMutex;
   /// The number of events above which the intermediate buffer will be flushed
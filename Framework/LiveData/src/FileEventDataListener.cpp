@@ -14,10 +14,12 @@
 #include "MantidKernel/ConfigService.h"
 #include "MantidKernel/TimeSeriesProperty.h"
 
+#include <Poco/Thread.h>
 #include <algorithm>
 
 using namespace Mantid::Kernel;
 using namespace Mantid::API;
+using Mantid::Types::Core::DateAndTime;
 
 namespace Mantid::LiveData {
 DECLARE_LISTENER(FileEventDataListener)
@@ -30,7 +32,8 @@ Kernel::Logger g_log("FileEventDataListener");
 /// Constructor
 FileEventDataListener::FileEventDataListener()
     : LiveListener(), m_filename(), m_runNumber(-1), m_tempWSname("__filelistenerchunk"), m_nextChunk(1),
-      m_filePropName("Filename"), m_loaderName(""), m_canLoadMonitors(true), m_chunkload(nullptr) {
+      m_filePropName("Filename"), m_loaderName(""), m_canLoadMonitors(true), m_eventRate(0.0), m_eventsReplayed(0),
+      m_replayLag(0.0), m_chunkload(nullptr) {
   std::string tfilename = ConfigService::Instance().getString("fileeventdatalistener.filename");
   if (tfilename.empty()) {
     g_log.error("Configuration property fileeventdatalistener.filename not "
@@ -64,6 +67,8 @@ FileEventDataListener::FileEventDataListener()
                 "found. The algorithm will fail!");
   }
 
+  m_eventRate = ConfigService::Instance().getValue<double>("fileeventdatalistener.eventrate").value_or(0.0);
+
   // Add an integer, incremented for each listener instance, to the temporary
   // workspace name so that multiple
   // listeners can be in existence at the same time.
@@ -146,6 +151,9 @@ std::shared_ptr<Workspace> FileEventDataListener::doExtractData() {
 
   m_runNumber = chunk->getRunNumber();
 
+  if (auto eventChunk = std::dynamic_pointer_cast<DataObjects::EventWorkspace>(chunk))
+    waitForReplayTime(eventChunk->getNumberEvents());
+
   if (m_loaderName == "LoadEventNexus") {
     // Scale the proton charge by the number of chunks
     TimeSeriesProperty<double> *pcharge = chunk->mutableRun().getTimeSeriesProperty<double>("proton_charge");
@@ -159,6 +167,36 @@ std::shared_ptr<Workspace> FileEventDataListener::doExtractData() {
   return chunk;
 }
 
+/** Pace the replay of the file. The first chunk is handed out immediately and
+ * starts the replay clock; every following chunk is held back until all of its
+ * events would have arrived at the configured event rate. If the caller asks
+ * for a chunk after it was due, the delay is recorded as the replay lag.
+ *
+ * @param numEvents :: number of events in the chunk being handed out
+ */
+void FileEventDataListener::waitForReplayTime(std::size_t numEvents) {
+  const auto now = DateAndTime::getCurrentTime();
+  if (m_eventRate <= 0.0) {
+    m_lastChunkDueTime = now;
+    return;
+  }
+
+  if (m_eventsReplayed == 0) {
+    // Pretend the first chunk streamed in at the requested rate up to now
+    m_replayStart = now - static_cast<double>(numEvents) / m_eventRate;
+  }
+  m_eventsReplayed += numEvents;
+  m_lastChunkDueTime = m_replayStart + static_cast<double>(m_eventsReplayed) / m_eventRate;
+
+  const double wait = DateAndTime::secondsFromDuration(m_lastChunkDueTime - now);
+  if (wait > 0.0) {
+    Poco::Thread::sleep(static_cast<long>(wait * 1000.0));
+    m_replayLag = 0.0;
+  } else {
+    m_replayLag = -wait;
+  }
+}
+
 /// Load the next chunk of data. Calls Algorithm::executeAsync to do it in
 /// another thread.
 void FileEventDataListener::loadChunk() {
@@ -29,13 +29,12 @@ GNU_DIAG_OFF("conversion")
 #include "private/Schema/is84_isis_events_generated.h"
 GNU_DIAG_ON("conversion")
 
+#include <algorithm>
 #include <chrono>
 #include <json/json.h>
 #include <numeric>
 #include <utility>
 
-#include <tbb/parallel_sort.h>
-
 using namespace Mantid::Types;
 using Mantid::Kernel::ConfigService;
 
@@ -83,21 +82,34 @@ void appendToLog(Mantid::API::Run &mutableRunInfo, const std::string &name, cons
   }
 }
 
-void sortIntermediateEventBuffer(
-    std::vector<Mantid::LiveData::KafkaEventStreamDecoder::BufferedEvent> &eventBuffer,
-    const std::vector<Mantid::LiveData::KafkaEventStreamDecoder::BufferedPulse> &pulseBuffer) {
-  tbb::parallel_sort(eventBuffer.begin(), eventBuffer.end(),
-                     [&](const Mantid::LiveData::KafkaEventStreamDecoder::BufferedEvent &lhs,
-                         const Mantid::LiveData::KafkaEventStreamDecoder::BufferedEvent &rhs) -> bool {
-                       const auto &lhsPulse = pulseBuffer[lhs.pulseIndex];
-                       const auto &rhsPulse = pulseBuffer[rhs.pulseIndex];
-
-                       /* If events are from different periods compare the period
-                        * numbers, otherwise compare the workspace index */
-                       return (lhsPulse.periodNumber != rhsPulse.periodNumber)
-                                  ? lhsPulse.periodNumber < rhsPulse.periodNumber
-                                  : lhs.wsIdx < rhs.wsIdx;
-                     });
+/**
+ * Order the buffered events by workspace index so that all events for a
+ * spectrum are contiguous. This is a stable counting sort, linear in the
+ * number of events, so the events of each spectrum stay in the order in which
+ * they were received.
+ *
+ * @param eventBuffer : events to sort
+ * @param scratch : reusable storage for the sorted events, swapped with
+ * eventBuffer on return
+ */
+void sortIntermediateEventBuffer(std::vector<Mantid::LiveData::KafkaEventStreamDecoder::BufferedEvent> &eventBuffer,
+                                 std::vector<Mantid::LiveData::KafkaEventStreamDecoder::BufferedEvent> &scratch) {
+  const auto maxEvent = std::max_element(
+      eventBuffer.cbegin(), eventBuffer.cend(),
+      [](const auto &lhs, const auto &rhs) -> bool { return lhs.wsIdx < rhs.wsIdx; });
+  if (maxEvent == eventBuffer.cend())
+    return;
+
+  /* Offset at which the events of each workspace index start */
+  std::vector<size_t> offsets(maxEvent->wsIdx + 2, 0);
+  for (const auto &event : eventBuffer)
+    ++offsets[event.wsIdx + 1];
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+  scratch.resize(eventBuffer.size());
+  for (const auto &event : eventBuffer)
+    scratch[offsets[event.wsIdx]++] = event;
+  std::swap(eventBuffer, scratch);
 }
 } // namespace
 
@@ -433,7 +445,7 @@ void KafkaEventStreamDecoder::flushIntermediateBuffer() {
 
   std::lock_guard<std::mutex> bufferLock(m_intermediateBufferMutex);
 
-  sortIntermediateEventBuffer(m_receivedEventBuffer, m_receivedPulseBuffer);
+  sortIntermediateEventBuffer(m_receivedEventBuffer, m_sortedEventBuffer);
 
   /* Compute groups for parallel insertion */
   const auto numberOfGroups = PARALLEL_GET_MAX_THREADS;
@@ -461,9 +473,10 @@ void KafkaEventStreamDecoder::flushIntermediateBuffer() {
     }
   }
 
-  /* Clear buffers */
+  /* Clear buffers, keeping their storage for the next flush */
   m_receivedPulseBuffer.clear();
   m_receivedEventBuffer.clear();
+  m_sortedEventBuffer.clear();
 
   const auto endTime = std::chrono::system_clock::now();
   const std::chrono::duration<double> dur = endTime - startTime;
@@ -118,6 +118,14 @@ void LiveDataAlgorithm::initProps() {
   declareProperty(std::make_unique<FileProperty>("PostProcessingScriptFilename", "", FileProperty::OptionalLoad, "py"),
                   " Python script that will be run to process the accumulated data.");
 
+  declareProperty("IncrementalPostProcessing", false,
+                  "Set if the post-processing is linear in the data, i.e. post-processing the\n"
+                  "sum of two chunks gives the sum of the post-processed chunks (for example\n"
+                  "ConvertUnits, DiffractionFocussing and Rebin). Each new chunk is then\n"
+                  "post-processed on its own and added to the OutputWorkspace, instead of\n"
+                  "re-processing the whole AccumulationWorkspace on every update.\n"
+                  "Requires AccumulationMethod=Add.");
+
   std::vector<std::string> runOptions{"Restart", "Stop", "Rename"};
   declareProperty("RunTransitionBehavior", "Restart", std::make_shared<StringListValidator>(runOptions),
                   "What to do at run start/end boundaries?\n"
@@ -367,6 +375,11 @@ std::map<std::string, std::string> LiveDataAlgorithm::validateInputs() {
       out["PostProcessingScript"] = msg;
       out["PostProcessingScriptFilename"] = msg;
     }
+
+    const bool incremental = this->getProperty("IncrementalPostProcessing");
+    if (incremental && this->getPropertyValue("AccumulationMethod") != "Add")
+      out["IncrementalPostProcessing"] = "Incremental post-processing requires "
+                                         "AccumulationMethod=Add.";
   }
 
   // For StartLiveData and MonitorLiveData, make sure another thread is not
@@ -10,10 +10,12 @@
 #include "MantidAPI/WorkspaceGroup.h"
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidKernel/CPUTimer.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/ReadLock.h"
 #include "MantidKernel/WriteLock.h"
 #include "MantidLiveData/Exception.h"
 
+#include <cmath>
 #include <utility>
 
 #include <Poco/Thread.h>
@@ -63,6 +65,77 @@ void copyInstrument(const API::Workspace *source, API::Workspace *target) {
     }
   }
 }
+
+/**
+ * Check whether a chunk can be added into the accumulation workspace in place,
+ * i.e. whether Plus would be a plain spectrum-by-spectrum sum of the two.
+ *
+ * @param accum : accumulation workspace
+ * @param chunk : processed chunk of live data
+ */
+bool canAddInPlace(const MatrixWorkspace &accum, const MatrixWorkspace &chunk) {
+  const size_t numHistograms = accum.getNumberHistograms();
+  if (chunk.getNumberHistograms() != numHistograms || accum.YUnit() != chunk.YUnit() ||
+      accum.isDistribution() != chunk.isDistribution())
+    return false;
+  const auto accumUnit = accum.getAxis(0)->unit();
+  const auto chunkUnit = chunk.getAxis(0)->unit();
+  if (!accumUnit || !chunkUnit || accumUnit->unitID() != chunkUnit->unitID())
+    return false;
+
+  const bool accumIsEvent = dynamic_cast<const EventWorkspace *>(&accum) != nullptr;
+  const bool chunkIsEvent = dynamic_cast<const EventWorkspace *>(&chunk) != nullptr;
+  if (accumIsEvent || chunkIsEvent)
+    return accumIsEvent && chunkIsEvent;
+
+  // Histograms can only be summed bin by bin if the binning is identical
+  for (size_t i = 0; i < numHistograms; ++i) {
+    if (accum.x(i).rawData() != chunk.x(i).rawData())
+      return false;
+  }
+  return true;
+}
+
+/**
+ * Add a chunk into the accumulation workspace in place, without running Plus.
+ * Event lists are appended and histograms summed spectrum by spectrum, so the
+ * cost depends on the size of the chunk rather than on the length of the run.
+ * The caller must hold the write lock of the accumulation workspace.
+ *
+ * @param accum : accumulation workspace, modified in place
+ * @param chunk : processed chunk of live data
+ * @return true if the chunk was added; false if the workspaces are not simple
+ * enough and Plus must be used instead.
+ */
+bool addInPlace(MatrixWorkspace &accum, const MatrixWorkspace &chunk) {
+  if (!canAddInPlace(accum, chunk))
+    return false;
+
+  const auto numHistograms = static_cast<int64_t>(accum.getNumberHistograms());
+  if (auto *accumEvents = dynamic_cast<EventWorkspace *>(&accum)) {
+    const auto &chunkEvents = dynamic_cast<const EventWorkspace &>(chunk);
+    PARALLEL_FOR_IF(Kernel::threadSafe(*accumEvents, chunkEvents))
+    for (int64_t i = 0; i < numHistograms; ++i) {
+      accumEvents->getSpectrum(i) += chunkEvents.getSpectrum(i);
+    }
+    accumEvents->clearMRU();
+  } else {
+    PARALLEL_FOR_IF(Kernel::threadSafe(accum, chunk))
+    for (int64_t i = 0; i < numHistograms; ++i) {
+      auto &y = accum.mutableY(i);
+      auto &e = accum.mutableE(i);
+      const auto &chunkY = chunk.y(i);
+      const auto &chunkE = chunk.e(i);
+      for (size_t j = 0; j < y.size(); ++j) {
+        y[j] += chunkY[j];
+        e[j] = std::sqrt(e[j] * e[j] + chunkE[j] * chunkE[j]);
+      }
+    }
+  }
+  // Proton charge, logs etc. are combined as Plus does
+  accum.mutableRun() += chunk.run();
+  return true;
+}
 } // namespace
 
 // Register the algorithm into the AlgorithmFactory
@@ -90,10 +163,13 @@ void LoadLiveData::init() { this->initProps(); }
  *
  * @param inputWS :: workspace being processed
  * @param PostProcess :: flag, TRUE if doing the post-processing
+ * @param chunkOnly :: flag, TRUE if post-processing a single chunk rather than
+ *the accumulation workspace
  * @return the processed workspace. Will point to inputWS if no processing is to
  *do
  */
-Mantid::API::Workspace_sptr LoadLiveData::runProcessing(Mantid::API::Workspace_sptr inputWS, bool PostProcess) {
+Mantid::API::Workspace_sptr LoadLiveData::runProcessing(Mantid::API::Workspace_sptr inputWS, bool PostProcess,
+                                                        bool chunkOnly) {
   if (!inputWS)
     throw std::runtime_error("LoadLiveData::runProcessing() called for an empty input workspace.");
   // Prevent others writing to the workspace while we run.
@@ -115,8 +191,10 @@ Mantid::API::Workspace_sptr LoadLiveData::runProcessing(Mantid::API::Workspace_s
     // Transform the chunk in-place
     std::string outputName = inputName;
 
-    // Except, no need for anonymous names with the post-processing
-    if (PostProcess) {
+    // Except, no need for anonymous names with the post-processing of the
+    // accumulated data
+    const bool accumulated = PostProcess && !chunkOnly;
+    if (accumulated) {
       inputName = this->getPropertyValue("AccumulationWorkspace");
       outputName = this->getPropertyValue("OutputWorkspace");
     }
@@ -168,7 +246,7 @@ Mantid::API::Workspace_sptr LoadLiveData::runProcessing(Mantid::API::Workspace_s
                                " Algorithm's OutputWorkspace property is not a WorkspaceProperty!");
     Workspace_sptr temp = wsProp->getWorkspace();
 
-    if (!PostProcess) {
+    if (!accumulated) {
       if (!temp) {
         // a group workspace cannot be returned by wsProp
         temp = AnalysisDataService::Instance().retrieve(inputName);
@@ -216,6 +294,25 @@ void LoadLiveData::runPostProcessing() {
   }
 }
 
+//----------------------------------------------------------------------------------------------
+/** Perform the PostProcessing steps on the latest chunk only, and add the
+ * result to the existing output workspace. This is only valid if the
+ * post-processing is linear in the data, so that its cost per update does not
+ * grow with the accumulated run.
+ * Updates the m_outputWS member.
+ *
+ * @param chunkWS :: processed live data chunk workspace
+ */
+void LoadLiveData::runIncrementalPostProcessing(const Mantid::API::Workspace_sptr &chunkWS) {
+  try {
+    auto postProcessed = runProcessing(chunkWS, true, true);
+    this->addChunk(m_outputWS, postProcessed);
+  } catch (...) {
+    g_log.error("While post processing:");
+    throw;
+  }
+}
+
 //----------------------------------------------------------------------------------------------
 /** Accumulate the data by adding (summing) to the output workspace.
  * Calls the Plus algorithm
@@ -223,14 +320,22 @@ void LoadLiveData::runPostProcessing() {
  *
  * @param chunkWS :: processed live data chunk workspace
  */
-void LoadLiveData::addChunk(const Mantid::API::Workspace_sptr &chunkWS) {
+void LoadLiveData::addChunk(const Mantid::API::Workspace_sptr &chunkWS) { addChunk(m_accumWS, chunkWS); }
+
+//----------------------------------------------------------------------------------------------
+/** Add (sum) a chunk of data to the given workspace.
+ *
+ * @param accumWS :: workspace to add to, replaced if the sum creates a new one
+ * @param chunkWS :: processed live data chunk workspace
+ */
+void LoadLiveData::addChunk(Workspace_sptr &accumWS, const Workspace_sptr &chunkWS) {
   // Acquire locks on the workspaces we use
-  WriteLock _lock1(*m_accumWS);
+  WriteLock _lock1(*accumWS);
   ReadLock _lock2(*chunkWS);
 
   // ISIS multi-period data come in workspace groups
   if (WorkspaceGroup_sptr gws = std::dynamic_pointer_cast<WorkspaceGroup>(chunkWS)) {
-    WorkspaceGroup_sptr accum_gws = std::dynamic_pointer_cast<WorkspaceGroup>(m_accumWS);
+    WorkspaceGroup_sptr accum_gws = std::dynamic_pointer_cast<WorkspaceGroup>(accumWS);
     if (!accum_gws) {
       throw std::runtime_error("Two workspace groups are expected.");
     }
@@ -245,16 +350,17 @@ void LoadLiveData::addChunk(const Mantid::API::Workspace_sptr &chunkWS) {
     }
   } else if (std::dynamic_pointer_cast<MatrixWorkspace>(chunkWS)) {
     // If workspace is a Matrix workspace just add the chunk
-    addMatrixWSChunk(m_accumWS, chunkWS);
+    addMatrixWSChunk(accumWS, chunkWS);
   } else {
     // Assume MD Workspace
-    addMDWSChunk(m_accumWS, chunkWS);
+    addMDWSChunk(accumWS, chunkWS);
   }
 }
 
 //----------------------------------------------------------------------------------------------
 /**
- * Add a matrix workspace to the accumulation workspace.
+ * Add a matrix workspace to the accumulation workspace. Matching event or
+ * histogram workspaces are summed in place; anything else goes through Plus.
  *
  * @param algoName :: Name of algorithm which will be adding the workspaces.
  * @param accumWS :: accumulation matrix workspace
@@ -268,9 +374,14 @@ void LoadLiveData::addMatrixWSChunk(const Workspace_sptr &accumWS, const Workspa
     auto accumMon = accumMW->monitorWorkspace();
     auto chunkMon = chunkMW->monitorWorkspace();
 
-    if (accumMon && chunkMon) {
+    if (accumMon && chunkMon && !addInPlace(*accumMon, *chunkMon)) {
       accumMon += chunkMon;
     }
+
+    // Simple cases are summed in place, so that the cost of an update does not
+    // grow with the size of the accumulated workspace
+    if (addInPlace(*accumMW, *chunkMW))
+      return;
   }
 
   // Now do the main workspace
@@ -571,7 +682,13 @@ void LoadLiveData::exec() {
 
   if (this->hasPostProcessing()) {
     // ----------- Run post-processing -------------
-    this->runPostProcessing();
+    // Linear post-processing only needs to see the new chunk, as long as the
+    // output still holds the post-processed sum of the previous ones
+    const bool incremental = this->getProperty("IncrementalPostProcessing");
+    if (incremental && accum == "Add" && m_outputWS && m_outputWS != m_accumWS)
+      this->runIncrementalPostProcessing(processed);
+    else
+      this->runPostProcessing();
     // Set both output workspaces
     this->setProperty("AccumulationWorkspace", m_accumWS);
     this->setProperty("OutputWorkspace", m_outputWS);
@@ -6,11 +6,18 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #pragma once
 
+#include "MantidAPI/AnalysisDataService.h"
+#include "MantidAPI/FrameworkManager.h"
 #include "MantidAPI/LiveListenerFactory.h"
 #include "MantidAPI/Run.h"
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidKernel/ConfigService.h"
+#include "MantidKernel/Memory.h"
+#include "MantidLiveData/FileEventDataListener.h"
+#include "MantidLiveData/LoadLiveData.h"
+#include <algorithm>
 #include <cxxtest/TestSuite.h>
+#include <iostream>
 
 using namespace Mantid::Kernel;
 using namespace Mantid::API;
@@ -179,3 +186,77 @@ public:
     TS_ASSERT_EQUALS(pcharge_onechunk * 0.5, pcharge_twochunk);
   }
 };
+
+/** Replays an event file through LoadLiveData at a fixed event rate, one call
+ * per chunk as MonitorLiveData would make, and reports the update latency, the
+ * backlog and the memory growth. Change the settings below to size a machine
+ * for a given instrument, rate and processing chain.
+ */
+class FileEventDataListenerTestPerformance : public CxxTest::TestSuite {
+public:
+  static FileEventDataListenerTestPerformance *createSuite() { return new FileEventDataListenerTestPerformance(); }
+  static void destroySuite(FileEventDataListenerTestPerformance *suite) { delete suite; }
+
+  FileEventDataListenerTestPerformance() { FrameworkManager::Instance(); }
+
+  void setUp() override {
+    ConfigService::Instance().setString("fileeventdatalistener.filename", m_filename);
+    ConfigService::Instance().setString("fileeventdatalistener.chunks", std::to_string(m_numChunks));
+    ConfigService::Instance().setString("fileeventdatalistener.eventrate", std::to_string(m_eventRate));
+  }
+
+  void tearDown() override {
+    ConfigService::Instance().setString("fileeventdatalistener.eventrate", "0");
+    AnalysisDataService::Instance().clear();
+  }
+
+  void test_replay_through_LoadLiveData() {
+    auto listener = std::dynamic_pointer_cast<Mantid::LiveData::FileEventDataListener>(
+        LiveListenerFactory::Instance().create("FileEventDataListener", true));
+    TS_ASSERT(listener)
+    listener->start();
+
+    MemoryStats memory;
+    const auto startMemory = memory.residentMem();
+    std::vector<double> latencies;
+    double maxLag(0.);
+    for (int chunk = 0; chunk < m_numChunks; ++chunk) {
+      Mantid::LiveData::LoadLiveData alg;
+      alg.initialize();
+      alg.setPropertyValue("AccumulationMethod", "Add");
+      alg.setProperty("PreserveEvents", true);
+      alg.setPropertyValue("PostProcessingAlgorithm", m_postProcessingAlgorithm);
+      alg.setPropertyValue("PostProcessingProperties", m_postProcessingProperties);
+      alg.setPropertyValue("AccumulationWorkspace", "replay_accum");
+      alg.setPropertyValue("OutputWorkspace", "replay");
+      alg.setLiveListener(listener);
+      TS_ASSERT_THROWS_NOTHING(alg.execute());
+
+      // Latency is measured from the moment the last event of the chunk arrived
+      const auto ready = Mantid::Types::Core::DateAndTime::getCurrentTime();
+      latencies.emplace_back(
+          Mantid::Types::Core::DateAndTime::secondsFromDuration(ready - listener->lastChunkDueTime()));
+      maxLag = std::max(maxLag, listener->replayLag());
+    }
+    memory.update();
+
+    std::sort(latencies.begin(), latencies.end());
+    const auto percentile = [&latencies](double fraction) {
+      return latencies[static_cast<size_t>(fraction * static_cast<double>(latencies.size() - 1))];
+    };
+    std::cout << "\nReplayed " << m_filename << " in " << m_numChunks << " chunks at " << m_eventRate
+              << " events/s\n"
+              << "Update latency (s): median " << percentile(0.5) << ", 90th percentile " << percentile(0.9)
+              << ", max " << latencies.back() << '\n'
+              << "Largest backlog: " << maxLag << " s, about " << maxLag * m_eventRate << " events\n"
+              << "Resident memory growth: "
+              << (static_cast<double>(memory.residentMem()) - static_cast<double>(startMemory)) / 1024. << " MiB\n";
+  }
+
+private:
+  const std::string m_filename{"EQSANS_89157.nxs.h5"};
+  const int m_numChunks{8};
+  const double m_eventRate{5000.};
+  const std::string m_postProcessingAlgorithm{"Rebin"};
+  const std::string m_postProcessingProperties{"Params=0,1000,100000;PreserveEvents=0"};
+};
@@ -278,6 +278,54 @@ public:
     TS_ASSERT_EQUALS(ws1->monitorWorkspace(), ws2->monitorWorkspace());
   }
 
+  //--------------------------------------------------------------------------------------------
+  void test_add_DontPreserveEvents_sums_errors_in_quadrature() {
+    Workspace2D_sptr ws1 = doExec<Workspace2D>("Add", "Rebin", "Params=40e3, 1e3, 60e3", "", "", false);
+    Workspace2D_sptr ws2 = doExec<Workspace2D>("Add", "Rebin", "Params=40e3, 1e3, 60e3", "", "", false);
+    TS_ASSERT_EQUALS(ws1, ws2);
+
+    // Both chunks hold raw counts, so the accumulated errors stay Poisson
+    for (size_t wi = 0; wi < ws2->getNumberHistograms(); ++wi) {
+      const auto &y = ws2->y(wi);
+      const auto &e = ws2->e(wi);
+      for (size_t i = 0; i < y.size(); ++i)
+        TS_ASSERT_DELTA(e[i] * e[i], y[i], 1e-8);
+    }
+  }
+
+  //--------------------------------------------------------------------------------------------
+  void test_add_IncrementalPostProcessing_sums_post_processed_chunks() {
+    auto runIncremental = [] {
+      FacilityHelper::ScopedFacilities loadTESTFacility("unit_testing/UnitTestFacilities.xml", "TEST");
+      LoadLiveData alg;
+      alg.initialize();
+      alg.setPropertyValue("Instrument", "TestDataListener");
+      alg.setPropertyValue("AccumulationMethod", "Add");
+      alg.setProperty("PreserveEvents", true);
+      alg.setPropertyValue("PostProcessingAlgorithm", "Rebin");
+      alg.setPropertyValue("PostProcessingProperties", "Params=40e3, 1e3, 60e3;PreserveEvents=0");
+      alg.setProperty("IncrementalPostProcessing", true);
+      alg.setPropertyValue("AccumulationWorkspace", "fake_accum");
+      alg.setPropertyValue("OutputWorkspace", "fake");
+      TS_ASSERT_THROWS_NOTHING(alg.execute());
+      TS_ASSERT(alg.isExecuted());
+      return AnalysisDataService::Instance().retrieveWS<Workspace2D>("fake");
+    };
+
+    // The first chunk goes through the full post-processing
+    auto ws1 = runIncremental();
+    TS_ASSERT_DELTA(std::accumulate(ws1->y(0).begin(), ws1->y(0).end(), 0.0), 100.0, 1e-4);
+
+    // The second is post-processed alone and summed into the same output
+    auto ws2 = runIncremental();
+    TSM_ASSERT("Output workspace was added to in place", ws1 == ws2);
+    TS_ASSERT_DELTA(std::accumulate(ws2->y(0).begin(), ws2->y(0).end(), 0.0), 200.0, 1e-4);
+
+    // The accumulation workspace still holds all the raw events
+    auto accum = AnalysisDataService::Instance().retrieveWS<EventWorkspace>("fake_accum");
+    TS_ASSERT_EQUALS(accum->getNumberEvents(), 400);
+  }
+
   //--------------------------------------------------------------------------------------------
   /** Simple processing of a chunk */
   void test_ProcessChunk_DoPreserveEvents() {
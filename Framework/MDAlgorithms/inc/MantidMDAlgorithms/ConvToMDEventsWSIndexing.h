@@ -69,6 +69,10 @@ private:
   template <typename EventType, size_t ND, template <size_t> class MDEventType>
   std::vector<MDEventType<ND>> convertEvents();
 
+  // Move the events of an existing output workspace into the vector to be redistributed
+  template <size_t ND, template <size_t> class MDEventType>
+  void moveExistingEvents(std::vector<MDEventType<ND>> &mdEvents);
+
   template <size_t ND, template <size_t> class MDEventType> struct MDEventMaker {
     static MDEventType<ND> makeMDEvent(const double &sig, const double &err, const uint16_t &expInfoIndex,
                                        const uint16_t &goniometer_index, const uint32_t &det_id, coord_t *coord) {
@@ -81,15 +85,26 @@ private:
 
 template <typename EventType, size_t ND, template <size_t> class MDEventType>
 std::vector<MDEventType<ND>> ConvToMDEventsWSIndexing::convertEvents() {
-  std::vector<MDEventType<ND>> mdEvents;
-  mdEvents.reserve(m_EventWS->getNumberEvents());
-
   const auto &pws = m_OutWSWrapper->pWorkspace();
   std::array<std::pair<coord_t, coord_t>, ND> bounds;
   for (size_t ax = 0; ax < ND; ++ax) {
     bounds[ax] = std::make_pair(pws->getDimension(ax)->getMinimum(), pws->getDimension(ax)->getMaximum());
   }
 
+  // The events already in the workspace (OverwriteExisting=false) are
+  // redistributed together with the new ones, so they go first.
+  std::vector<MDEventType<ND>> mdEvents;
+  mdEvents.reserve(static_cast<size_t>(pws->getNPoints()) + m_EventWS->getNumberEvents());
+  moveExistingEvents<ND, MDEventType>(mdEvents);
+
+  // Every spectrum gets a slot for all of its events, so the threads convert
+  // straight into the output vector, which is allocated exactly once
+  std::vector<size_t> offsets(m_NSpectra + 1, mdEvents.size());
+  for (size_t workspaceIndex = 0; workspaceIndex < m_NSpectra; ++workspaceIndex)
+    offsets[workspaceIndex + 1] = offsets[workspaceIndex] + m_EventWS->getSpectrum(workspaceIndex).getNumberEvents();
+  mdEvents.resize(offsets.back());
+  std::vector<size_t> numConverted(m_NSpectra, 0);
+
   std::vector<MDTransf_sptr> qConverters;
   for (int i = 0; i < numWorkers(); ++i)
     qConverters.emplace_back(m_QConverter->clone());
@@ -120,7 +135,7 @@ std::vector<MDEventType<ND>> ConvToMDEventsWSIndexing::convertEvents() {
     typename std::vector<EventType> const *events_ptr;
     getEventsFrom(el, events_ptr);
     const typename std::vector<EventType> &events = *events_ptr;
-    std::vector<MDEventType<ND>> mdEventsForSpectrum;
+    auto slot = mdEvents.begin() + offsets[workspaceIndex];
     // Iterators to start/end
     for (const auto &event : events) {
       double val = localUnitConv.convertUnits(event.tof());
@@ -130,31 +145,56 @@ std::vector<MDEventType<ND>> ConvToMDEventsWSIndexing::convertEvents() {
       if (!localQConverter->calcMatrixCoord(val, locCoord, signal, errorSq))
         continue; // skip ND outside the range
 
-      mdEventsForSpectrum.emplace_back(MDEventMaker<ND, MDEventType>::makeMDEvent(
-          signal, errorSq, expInfoIndexLoc, goniometerIndex, detID, &locCoord[0]));
-
       // Filter events before adding to the ndEvents vector to add in workspace
       // The bounds of the resulting WS have to be already defined
       bool isInOutWSBox = true;
       for (size_t ax = 0; ax < ND; ++ax) {
-        const coord_t &coord{mdEventsForSpectrum.back().getCenter(ax)};
-        if (coord < bounds[ax].first || coord > bounds[ax].second)
+        if (locCoord[ax] < bounds[ax].first || locCoord[ax] > bounds[ax].second)
           isInOutWSBox = false;
       }
-
       if (!isInOutWSBox)
-        mdEventsForSpectrum.pop_back();
-    }
+        continue;
 
-#pragma omp critical
-    {
-      /* Add to event list */
-      mdEvents.insert(mdEvents.cend(), mdEventsForSpectrum.begin(), mdEventsForSpectrum.end());
+      *slot++ = MDEventMaker<ND, MDEventType>::makeMDEvent(signal, errorSq, expInfoIndexLoc, goniometerIndex, detID,
+                                                           &locCoord[0]);
     }
+    numConverted[workspaceIndex] = static_cast<size_t>(std::distance(mdEvents.begin() + offsets[workspaceIndex], slot));
   }
+
+  // The events that were skipped leave gaps at the end of the slots, which
+  // are closed up in order
+  auto end = mdEvents.begin() + offsets.front();
+  for (size_t workspaceIndex = 0; workspaceIndex < m_NSpectra; ++workspaceIndex) {
+    const auto slot = mdEvents.begin() + offsets[workspaceIndex];
+    if (slot == end)
+      end += numConverted[workspaceIndex];
+    else
+      end = std::move(slot, slot + numConverted[workspaceIndex], end);
+  }
+  mdEvents.erase(end, mdEvents.end());
   return mdEvents;
 }
 
+template <size_t ND, template <size_t> class MDEventType>
+void ConvToMDEventsWSIndexing::moveExistingEvents(std::vector<MDEventType<ND>> &mdEvents) {
+  auto *ws = dynamic_cast<DataObjects::MDEventWorkspace<MDEventType<ND>, ND> *>(m_OutWSWrapper->pWorkspace().get());
+  if (!ws || ws->getNPoints() == 0)
+    return;
+
+  std::vector<API::IMDNode *> boxes;
+  ws->getBox()->getBoxes(boxes, 1000, true);
+  for (auto node : boxes) {
+    auto *box = dynamic_cast<DataObjects::MDBox<MDEventType<ND>, ND> *>(node);
+    if (!box)
+      continue;
+    auto &boxEvents = box->getEvents();
+    mdEvents.insert(mdEvents.end(), boxEvents.cbegin(), boxEvents.cend());
+    // The old box tree is replaced by the new one, so its memory can go now
+    std::vector<MDEventType<ND>>().swap(boxEvents);
+    box->releaseEvents();
+  }
+}
+
 template <typename EventType, size_t ND, template <size_t> class MDEventType>
 void ConvToMDEventsWSIndexing::appendEvents(API::Progress *pProgress, const API::BoxController_sptr &bc) {
   bc->clearBoxesCounter(1);
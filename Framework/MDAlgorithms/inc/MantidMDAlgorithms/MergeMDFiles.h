@@ -54,6 +54,10 @@ private:
 
   uint64_t loadEventsFromSubBoxes(API::IMDNode *TargetBox);
 
+  uint64_t loadEventsFromSubBoxesConcurrently(API::IMDNode *TargetBox);
+
+  void loadAndSaveBoxes(const std::vector<API::IMDNode *> &leafBoxes, bool parallel);
+
   // the class which flatten the box structure and deal with it
   DataObjects::MDBoxFlatTree m_BoxStruct;
   // the vector of box structures for contributing files components
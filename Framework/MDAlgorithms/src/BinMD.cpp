@@ -236,11 +236,6 @@ template <typename MDE, size_t nd> void BinMD::binByIterating(typename MDEventWo
   errors = outWS->mutableErrorSquaredArray();
   numEvents = outWS->mutableNumEventsArray();
 
-  if (!m_accumulate) {
-    // Start with signal/error/numEvents at 0.0
-    outWS->setTo(0.0, 0.0, 0.0);
-  }
-
   // The dimension (in the output workspace) along which we chunk for parallel
   // processing
   // TODO: Find the smartest dimension to chunk against
@@ -358,11 +353,12 @@ void BinMD::exec() {
   // This gets deleted by the thread pool; don't delete it in here.
   prog = std::make_unique<Progress>(this, 0.0, 1.0, 1);
 
-  // Create the dense histogram. This allocates the memory
+  // Create the dense histogram with signal/error/numEvents at 0.0. The memory
+  // for bins that receive no events is never committed.
   std::shared_ptr<IMDHistoWorkspace> tmp = this->getProperty("TemporaryDataWorkspace");
   outWS = std::dynamic_pointer_cast<MDHistoWorkspace>(tmp);
   if (!outWS) {
-    outWS = std::make_shared<MDHistoWorkspace>(m_binDimensions);
+    outWS = std::make_shared<MDHistoWorkspace>(m_binDimensions, API::NoNormalization, true);
   } else {
     m_accumulate = true;
   }
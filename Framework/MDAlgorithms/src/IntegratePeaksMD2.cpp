@@ -44,6 +44,7 @@
 #include <cmath>
 #include <fstream>
 #include <gsl/gsl_integration.h>
+#include <tbb/enumerable_thread_specific.h>
 
 namespace Mantid::MDAlgorithms {
 
@@ -57,6 +58,146 @@ using namespace Mantid::DataObjects;
 using namespace Mantid::DataObjects;
 using namespace Mantid::Geometry;
 
+namespace {
+/// A sphere (innerRadiusSquared == 0) or spherical shell around a peak centre
+template <size_t nd> struct SphereRegion {
+  coord_t center[nd];
+  coord_t radiusSquared{0};
+  coord_t innerRadiusSquared{0};
+  signal_t signal{0};
+  signal_t errorSquared{0};
+};
+
+/// Per-thread sums of signal and error squared, one entry per region
+struct RegionAccumulator {
+  explicit RegionAccumulator(size_t numRegions) : signal(numRegions, 0.), errorSquared(numRegions, 0.) {}
+  std::vector<signal_t> signal;
+  std::vector<signal_t> errorSquared;
+};
+
+template <size_t nd> coord_t distanceSquared(const coord_t *point, const coord_t *center) {
+  coord_t distanceSquared = 0;
+  for (size_t d = 0; d < nd; ++d) {
+    const coord_t dist = point[d] - center[d];
+    distanceSquared += dist * dist;
+  }
+  return distanceSquared;
+}
+
+template <typename MDE, size_t nd>
+void integrateSpheresInNode(API::IMDNode *node, const std::vector<size_t> &candidates,
+                            const std::vector<SphereRegion<nd>> &regions, RegionAccumulator &sums,
+                            const bool useOnePercentBackgroundCorrection);
+
+/** Add the contribution of one child box to every candidate region, applying
+ * the same rules as MDGridBox::integrateSphere: boxes with all vertices inside
+ * a region contribute their cached totals, boxes that cannot touch it are
+ * skipped and all others are refined. The regions that still need the events
+ * of the child are then integrated in a single visit of the child.
+ */
+template <typename MDE, size_t nd>
+void integrateSpheresInChild(API::IMDNode *child, const std::vector<size_t> &candidates,
+                             const std::vector<SphereRegion<nd>> &regions, RegionAccumulator &sums,
+                             const bool useOnePercentBackgroundCorrection) {
+  constexpr size_t maxVertices = 1 << nd;
+  coord_t vertices[maxVertices][nd];
+  coord_t boxCenter[nd];
+  double diagonalSquared = 0.;
+  for (size_t d = 0; d < nd; ++d) {
+    const auto &extents = child->getExtents(d);
+    for (size_t vertex = 0; vertex < maxVertices; ++vertex)
+      vertices[vertex][d] = (vertex & (size_t(1) << d)) ? extents.getMax() : extents.getMin();
+    diagonalSquared += extents.getSize() * extents.getSize();
+  }
+  child->getCenter(boxCenter);
+  const double boxRadius = std::sqrt(diagonalSquared);
+
+  std::vector<size_t> childCandidates;
+  for (const auto region : candidates) {
+    const auto &sphere = regions[region];
+    size_t verticesContained = 0;
+    for (size_t vertex = 0; vertex < maxVertices; ++vertex) {
+      const coord_t radiusSquared = distanceSquared<nd>(vertices[vertex], sphere.center);
+      if (radiusSquared < sphere.radiusSquared && radiusSquared > sphere.innerRadiusSquared)
+        ++verticesContained;
+    }
+    if (verticesContained == maxVertices) {
+      sums.signal[region] += child->getSignal();
+      sums.errorSquared[region] += child->getErrorSquared();
+      continue;
+    }
+    if (verticesContained == 0) {
+      const double distToBoxCenter = std::sqrt(static_cast<double>(distanceSquared<nd>(boxCenter, sphere.center)));
+      if (distToBoxCenter - std::sqrt(sphere.radiusSquared) > boxRadius)
+        continue;
+      if (sphere.innerRadiusSquared > 0 && distToBoxCenter + boxRadius < std::sqrt(sphere.innerRadiusSquared))
+        continue;
+    }
+    childCandidates.emplace_back(region);
+  }
+  if (!childCandidates.empty())
+    integrateSpheresInNode<MDE, nd>(child, childCandidates, regions, sums, useOnePercentBackgroundCorrection);
+}
+
+/** Integrate the candidate regions over the events of a box and its children,
+ * with the same results as calling integrateSphere on it once per region.
+ */
+template <typename MDE, size_t nd>
+void integrateSpheresInNode(API::IMDNode *node, const std::vector<size_t> &candidates,
+                            const std::vector<SphereRegion<nd>> &regions, RegionAccumulator &sums,
+                            const bool useOnePercentBackgroundCorrection) {
+  if (!node->isBox()) {
+    for (size_t i = 0; i < node->getNumChildren(); ++i)
+      integrateSpheresInChild<MDE, nd>(node->getChild(i), candidates, regions, sums,
+                                       useOnePercentBackgroundCorrection);
+    return;
+  }
+
+  const auto &events = static_cast<MDBox<MDE, nd> *>(node)->getConstEvents();
+  std::vector<std::pair<signal_t, signal_t>> shellValues;
+  for (const auto region : candidates) {
+    const auto &sphere = regions[region];
+    if (sphere.innerRadiusSquared == 0.0) {
+      for (const auto &event : events) {
+        if (distanceSquared<nd>(event.getCenter(), sphere.center) < sphere.radiusSquared) {
+          sums.signal[region] += static_cast<signal_t>(event.getSignal());
+          sums.errorSquared[region] += static_cast<signal_t>(event.getErrorSquared());
+        }
+      }
+    } else {
+      shellValues.clear();
+      for (const auto &event : events) {
+        const coord_t radiusSquared = distanceSquared<nd>(event.getCenter(), sphere.center);
+        if (radiusSquared < sphere.radiusSquared && radiusSquared > sphere.innerRadiusSquared)
+          shellValues.emplace_back(event.getSignal(), event.getErrorSquared());
+      }
+      std::sort(shellValues.begin(), shellValues.end(),
+                [](const auto &a, const auto &b) { return a.first < b.first; });
+      // Remove top 1% of background
+      const size_t endIndex = useOnePercentBackgroundCorrection
+                                  ? static_cast<size_t>(0.99 * static_cast<double>(shellValues.size()))
+                                  : shellValues.size();
+      for (size_t k = 0; k < endIndex; ++k) {
+        sums.signal[region] += shellValues[k].first;
+        sums.errorSquared[region] += shellValues[k].second;
+      }
+    }
+  }
+}
+
+/// Add the per-thread sums into the regions
+template <size_t nd>
+void addRegionSums(const tbb::enumerable_thread_specific<RegionAccumulator> &threadSums,
+                   std::vector<SphereRegion<nd>> &regions) {
+  for (const auto &sums : threadSums) {
+    for (size_t region = 0; region < regions.size(); ++region) {
+      regions[region].signal += sums.signal[region];
+      regions[region].errorSquared += sums.errorSquared[region];
+    }
+  }
+}
+} // namespace
+
 /** Initialize the algorithm's properties.
  */
 void IntegratePeaksMD2::init() {
@@ -462,11 +603,97 @@ template <typename MDE, size_t nd> void IntegratePeaksMD2::integrate(typename MD
   // volume of PeakRadius sphere
   double volumeRadius = 4.0 / 3.0 * M_PI * std::pow(PeakRadius[0], 3);
 
+  // Get the peak center as a position in the dimensions of the workspace
+  const auto peakPosition = [CoordinatesToUse](const IPeak &p) {
+    if (CoordinatesToUse == Mantid::Kernel::QLab) //"Q (lab frame)"
+      return p.getQLabFrame();
+    else if (CoordinatesToUse == Mantid::Kernel::QSample) //"Q (sample frame)"
+      return p.getQSampleFrame();
+    else if (CoordinatesToUse == Mantid::Kernel::HKL) //"HKL"
+      return p.getHKL();
+    throw std::runtime_error("Workspace does not have a coordinate system set");
+  };
+  // Radii of the peak sphere and of the background shell, which grow with |Q|
+  // when the adaptive options are used
+  const auto adaptiveRadii = [&](const coord_t *center) {
+    // modulus of Q
+    coord_t lenQpeak = 0.0;
+    if (adaptiveQMultiplier != 0.0) {
+      for (size_t d = 0; d < nd; ++d) {
+        lenQpeak += center[d] * center[d];
+      }
+      lenQpeak = std::sqrt(lenQpeak);
+    }
+    return std::array<double, 3>{
+        adaptiveQMultiplier * lenQpeak + *std::max_element(PeakRadius.begin(), PeakRadius.end()),
+        adaptiveQBackgroundMultiplier * lenQpeak +
+            *std::max_element(BackgroundInnerRadius.begin(), BackgroundInnerRadius.end()),
+        adaptiveQBackgroundMultiplier * lenQpeak +
+            *std::max_element(BackgroundOuterRadius.begin(), BackgroundOuterRadius.end())};
+  };
+
   // Initialize progress reporting
   int nPeaks = peakWS->getNumberPeaks();
-  Progress progress(this, 0., 1., nPeaks);
-  int zeroHKLCount = 0;
   bool doParallel = cylinderBool ? false : Kernel::threadSafe(*ws, *peakWS);
+
+  // Spheres are integrated for all the peaks together in a single traversal of
+  // the boxes, rather than walking the box tree once per peak. Entry 2*i holds
+  // the peak sphere of peak i and 2*i+1 its background shell.
+  const bool integrateSpheresTogether = !cylinderBool && !isEllipse && !ws->isFileBacked();
+  const bool integrateShells = BackgroundOuterRadius[0] > PeakRadius[0];
+  std::vector<SphereRegion<nd>> sphereRegions;
+  if (integrateSpheresTogether) {
+    sphereRegions.resize(2 * static_cast<size_t>(nPeaks));
+    for (int i = 0; i < nPeaks; ++i) {
+      const V3D pos = peakPosition(peakWS->getPeak(i));
+      auto &sphere = sphereRegions[2 * i];
+      for (size_t d = 0; d < nd; ++d)
+        sphere.center[d] = static_cast<coord_t>(pos[d]);
+      const auto radii = adaptiveRadii(sphere.center);
+      if (radii[0] <= 0.0)
+        continue;
+      sphere.radiusSquared = static_cast<coord_t>(radii[0] * radii[0]);
+      if (integrateShells) {
+        auto &shell = sphereRegions[2 * i + 1];
+        std::copy(std::begin(sphere.center), std::end(sphere.center), std::begin(shell.center));
+        shell.radiusSquared = static_cast<coord_t>(pow(radii[2], 2));
+        shell.innerRadiusSquared = static_cast<coord_t>(pow(radii[1], 2));
+      }
+    }
+    std::vector<size_t> candidates;
+    candidates.reserve(sphereRegions.size());
+    for (size_t region = 0; region < sphereRegions.size(); ++region) {
+      if (sphereRegions[region].radiusSquared > 0)
+        candidates.emplace_back(region);
+    }
+
+    // Each box is visited once for all the regions that overlap it. The
+    // top-level boxes are shared out between threads, which accumulate into
+    // their own sums, created on first use in that thread.
+    tbb::enumerable_thread_specific<RegionAccumulator> threadSums(
+        [&sphereRegions]() { return RegionAccumulator(sphereRegions.size()); });
+    auto *rootBox = ws->getBox();
+    if (rootBox->isBox()) {
+      integrateSpheresInNode<MDE, nd>(rootBox, candidates, sphereRegions, threadSums.local(),
+                                      useOnePercentBackgroundCorrection);
+    } else {
+      const auto numChildren = static_cast<int64_t>(rootBox->getNumChildren());
+      Progress sphereProgress(this, 0., 0.5, numChildren);
+      PARALLEL_FOR_IF(Kernel::threadSafe(*ws))
+      for (int64_t i = 0; i < numChildren; ++i) {
+        PARALLEL_START_INTERRUPT_REGION
+        integrateSpheresInChild<MDE, nd>(rootBox->getChild(static_cast<size_t>(i)), candidates, sphereRegions,
+                                         threadSums.local(), useOnePercentBackgroundCorrection);
+        sphereProgress.report();
+        PARALLEL_END_INTERRUPT_REGION
+      }
+      PARALLEL_CHECK_INTERRUPT_REGION
+    }
+    addRegionSums<nd>(threadSums, sphereRegions);
+  }
+
+  Progress progress(this, integrateSpheresTogether ? 0.5 : 0., 1., nPeaks);
+  int zeroHKLCount = 0;
   PARALLEL_SET_CONFIG_THREADS PRAGMA_OMP(parallel for if(doParallel) reduction(+:zeroHKLCount))
   for (int i = 0; i < nPeaks; ++i) {
     PARALLEL_START_INTERRUPT_REGION
@@ -475,21 +702,11 @@ template <typename MDE, size_t nd> void IntegratePeaksMD2::integrate(typename MD
     // Get a direct ref to that peak.
     IPeak &p = peakWS->getPeak(i);
 
-    // Get the peak center as a position in the dimensions of the workspace
+    const V3D pos = peakPosition(p);
     bool missingIndex = false; // True if in HKL mode and pos is 0,0,0
-    V3D pos;
-    if (CoordinatesToUse == Mantid::Kernel::QLab) //"Q (lab frame)"
-      pos = p.getQLabFrame();
-    else if (CoordinatesToUse == Mantid::Kernel::QSample) //"Q (sample frame)"
-      pos = p.getQSampleFrame();
-    else if (CoordinatesToUse == Mantid::Kernel::HKL) { //"HKL"
-      pos = p.getHKL();
-      if (pos.X() == 0 && pos.Y() == 0 && pos.Z() == 0) {
-        ++zeroHKLCount;
-        missingIndex = true;
-      }
-    } else {
-      throw std::runtime_error("Workspace does not have a coordinate system set");
+    if (CoordinatesToUse == Mantid::Kernel::HKL && pos.X() == 0 && pos.Y() == 0 && pos.Z() == 0) {
+      ++zeroHKLCount;
+      missingIndex = true;
     }
     // Do not integrate if sphere is off edge of detector
 
@@ -520,16 +737,8 @@ template <typename MDE, size_t nd> void IntegratePeaksMD2::integrate(typename MD
     signal_t bgErrorSquared = 0;
     double background_total = 0.0;
     if (!cylinderBool) {
-      // modulus of Q
-      coord_t lenQpeak = 0.0;
-      if (adaptiveQMultiplier != 0.0) {
-        lenQpeak = 0.0;
-        for (size_t d = 0; d < nd; ++d) {
-          lenQpeak += center[d] * center[d];
-        }
-        lenQpeak = std::sqrt(lenQpeak);
-      }
-      double adaptiveRadius = adaptiveQMultiplier * lenQpeak + *std::max_element(PeakRadius.begin(), PeakRadius.end());
+      const auto radii = adaptiveRadii(center);
+      double adaptiveRadius = radii[0];
       if (adaptiveRadius <= 0.0) {
         g_log.error() << "Error: Radius for integration sphere of peak " << i << " is negative =  " << adaptiveRadius
                       << '\n';
@@ -542,10 +751,8 @@ template <typename MDE, size_t nd> void IntegratePeaksMD2::integrate(typename MD
         continue;
       }
       PeakRadiusVector[i] = adaptiveRadius;
-      BackgroundInnerRadiusVector[i] = adaptiveQBackgroundMultiplier * lenQpeak +
-                                       *std::max_element(BackgroundInnerRadius.begin(), BackgroundInnerRadius.end());
-      BackgroundOuterRadiusVector[i] = adaptiveQBackgroundMultiplier * lenQpeak +
-                                       *std::max_element(BackgroundOuterRadius.begin(), BackgroundOuterRadius.end());
+      BackgroundInnerRadiusVector[i] = radii[1];
+      BackgroundOuterRadiusVector[i] = radii[2];
       // define the radius squared for a sphere intially
       CoordTransformDistance getRadiusSq(nd, center, dimensionsUsed);
       // set spherical shape
@@ -556,11 +763,16 @@ template <typename MDE, size_t nd> void IntegratePeaksMD2::integrate(typename MD
       const double scaleFactor = pow(PeakRadiusVector[i], 3) /
                                  (pow(BackgroundOuterRadiusVector[i], 3) - pow(BackgroundInnerRadiusVector[i], 3));
       // Integrate spherical background shell if specified
-      if (BackgroundOuterRadius[0] > PeakRadius[0]) {
+      if (integrateShells) {
         // Get the total signal inside background shell
-        ws->getBox()->integrateSphere(
-            getRadiusSq, static_cast<coord_t>(pow(BackgroundOuterRadiusVector[i], 2)), bgSignal, bgErrorSquared,
-            static_cast<coord_t>(pow(BackgroundInnerRadiusVector[i], 2)), useOnePercentBackgroundCorrection);
+        if (integrateSpheresTogether) {
+          bgSignal = sphereRegions[2 * i + 1].signal;
+          bgErrorSquared = sphereRegions[2 * i + 1].errorSquared;
+        } else {
+          ws->getBox()->integrateSphere(
+              getRadiusSq, static_cast<coord_t>(pow(BackgroundOuterRadiusVector[i], 2)), bgSignal, bgErrorSquared,
+              static_cast<coord_t>(pow(BackgroundInnerRadiusVector[i], 2)), useOnePercentBackgroundCorrection);
+        }
         // correct bg signal by Vpeak/Vshell (same for sphere and ellipse)
         bgSignal *= scaleFactor;
         bgErrorSquared *= scaleFactor * scaleFactor;
@@ -703,9 +915,14 @@ template <typename MDE, size_t nd> void IntegratePeaksMD2::integrate(typename MD
           p.setPeakShape(ellipsoidShape);
         }
       }
-      ws->getBox()->integrateSphere(getRadiusSq, static_cast<coord_t>(PeakRadiusVector[i] * PeakRadiusVector[i]),
-                                    signal, errorSquared, 0.0 /* innerRadiusSquared */,
-                                    useOnePercentBackgroundCorrection);
+      if (integrateSpheresTogether) {
+        signal = sphereRegions[2 * i].signal;
+        errorSquared = sphereRegions[2 * i].errorSquared;
+      } else {
+        ws->getBox()->integrateSphere(getRadiusSq, static_cast<coord_t>(PeakRadiusVector[i] * PeakRadiusVector[i]),
+                                      signal, errorSquared, 0.0 /* innerRadiusSquared */,
+                                      useOnePercentBackgroundCorrection);
+      }
       //
     } else {
       CoordTransformDistance cylinder(nd, center, dimensionsUsed, 2);
@@ -27,6 +27,7 @@
 #include "MantidKernel/EnabledWhenProperty.h"
 #include "MantidKernel/MDUnit.h"
 #include "MantidKernel/MDUnitFactory.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/Memory.h"
 #include "MantidKernel/PropertyWithValue.h"
 #include "MantidMDAlgorithms/SetMDFrame.h"
@@ -545,19 +546,23 @@ template <typename MDE, size_t nd> void LoadMD::doLoad(typename MDEventWorkspace
     prog->setNumSteps(numBoxes);
     std::vector<coord_t> boxTemp;
 
-    for (size_t i = 0; i < numBoxes; i++) {
+    // The loader serialises the reads from the file, so only the unpacking of
+    // the data into the events of different boxes runs concurrently.
+    const auto numBoxesToLoad = static_cast<int64_t>(numBoxes);
+    PARALLEL_FOR_NOWS_CHECK_FIRSTPRIVATE(boxTemp)
+    for (int64_t i = 0; i < numBoxesToLoad; i++) {
+      PARALLEL_START_INTERRUPT_REGION
       prog->report();
       auto *box = dynamic_cast<MDBox<MDE, nd> *>(boxTree[i]);
-      if (!box)
-        continue;
-
-      if (BoxEventIndex[2 * i + 1] > 0) // Load in memory NOT using the file as the back-end,
+      if (box && BoxEventIndex[2 * i + 1] > 0) // Load in memory NOT using the file as the back-end,
       {
         boxTree[i]->reserveMemoryForLoad(BoxEventIndex[2 * i + 1]);
         boxTree[i]->loadAndAddFrom(loader.get(), BoxEventIndex[2 * i], static_cast<size_t>(BoxEventIndex[2 * i + 1]),
                                    boxTemp);
       }
+      PARALLEL_END_INTERRUPT_REGION
     }
+    PARALLEL_CHECK_INTERRUPT_REGION
     loader->closeFile();
   } else // box structure and metadata only
   {
@@ -12,12 +12,15 @@
 #include "MantidDataObjects/MDEventFactory.h"
 #include "MantidDataObjects/MDEventWorkspace.h"
 #include "MantidKernel/CPUTimer.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/Strings.h"
 #include "MantidKernel/VectorHelper.h"
 #include "MantidNexus/NexusFile.h"
 
 #include <boost/scoped_ptr.hpp>
+#include <algorithm>
 #include <filesystem>
+#include <iterator>
 
 using namespace Mantid::Kernel;
 using namespace Mantid::API;
@@ -25,6 +28,11 @@ using namespace Mantid::DataObjects;
 
 namespace Mantid::MDAlgorithms {
 
+namespace {
+/// Memory (in bytes) the events of one batch of boxes may occupy when the boxes are merged in parallel
+constexpr uint64_t PARALLEL_BATCH_MEMORY = 400000000;
+} // namespace
+
 // Register the algorithm into the AlgorithmFactory
 DECLARE_ALGORITHM(MergeMDFiles)
 
@@ -58,6 +66,8 @@ void MergeMDFiles::init() {
 
   declareProperty("Parallel", false,
                   "Run the loading tasks in parallel.\n"
+                  "Boxes are merged in batches: file reads are serialised but the events are\n"
+                  "unpacked concurrently and each batch is written out before the next is read.\n"
                   "This can be faster but might use more memory.");
 
   declareProperty(std::make_unique<WorkspaceProperty<IMDEventWorkspace>>("OutputWorkspace", "", Direction::Output),
@@ -174,6 +184,97 @@ uint64_t MergeMDFiles::loadEventsFromSubBoxes(API::IMDNode *TargetBox) {
   return nBoxEvents;
 }
 
+/** Load all of the events contributing to a box of the output workspace while
+ * other threads do the same for other boxes. The reads from the (not thread-safe)
+ * NeXus files are serialised, but the unpacking of the data into events runs
+ * outside of the file lock.
+ *
+ * @param TargetBox :: the box of the output workspace to fill
+ * @return the number of events loaded into the box
+ */
+uint64_t MergeMDFiles::loadEventsFromSubBoxesConcurrently(API::IMDNode *TargetBox) {
+  TargetBox->clear();
+
+  const size_t ID = TargetBox->getID();
+  const uint64_t nBoxEvents = m_BoxStruct.getEventIndex()[2 * ID + 1];
+  if (nBoxEvents == 0)
+    return 0;
+
+  std::vector<coord_t> boxData;
+  std::vector<coord_t> fileData;
+  for (size_t iw = 0; iw < this->m_EventLoader.size(); iw++) {
+    const auto &fileEventIndex = m_fileComponentsStructure[iw].getEventIndex();
+    const auto numFileEvents = static_cast<size_t>(fileEventIndex[2 * ID + 1]);
+    if (numFileEvents == 0)
+      continue;
+    {
+      std::lock_guard<std::mutex> lock(m_fileMutex);
+      m_EventLoader[iw]->loadBlock(fileData, fileEventIndex[2 * ID + 0], numFileEvents);
+    }
+    if (boxData.empty()) {
+      // the size of the data of all files is only known after the first read
+      boxData.reserve(fileData.size() / numFileEvents * nBoxEvents);
+    }
+    boxData.insert(boxData.end(), fileData.cbegin(), fileData.cend());
+  }
+  TargetBox->setEventsData(boxData);
+
+  return nBoxEvents;
+}
+
+/** Fill the leaf boxes of the output workspace with the events from all files and,
+ * for a file-backed output, write them to the target file and release their memory.
+ *
+ * In parallel mode the boxes are processed in batches limited by the memory their events
+ * occupy: the boxes of a batch are loaded concurrently and then written out in the order of
+ * their positions in the target file before the next batch is loaded.
+ *
+ * @param leafBoxes :: the boxes to fill, in the order of their positions in the target file
+ * @param parallel :: if true, load the boxes of a batch in parallel
+ */
+void MergeMDFiles::loadAndSaveBoxes(const std::vector<API::IMDNode *> &leafBoxes, bool parallel) {
+  const std::vector<uint64_t> &targetEventIndexes = m_BoxStruct.getEventIndex();
+  const uint64_t batchEventLimit = std::max<uint64_t>(1, PARALLEL_BATCH_MEMORY / m_OutIWS->sizeofEvent());
+  const bool fileBacked = m_fileBasedTargetWS;
+
+  size_t batchStart = 0;
+  while (batchStart < leafBoxes.size()) {
+    size_t batchEnd = batchStart + 1;
+    if (parallel) {
+      uint64_t batchEvents = targetEventIndexes[2 * leafBoxes[batchStart]->getID() + 1];
+      while (batchEnd < leafBoxes.size() && batchEvents < batchEventLimit) {
+        batchEvents += targetEventIndexes[2 * leafBoxes[batchEnd]->getID() + 1];
+        ++batchEnd;
+      }
+    }
+
+    const auto batchSize = static_cast<int64_t>(batchEnd - batchStart);
+    if (parallel && batchSize > 1) {
+      PARALLEL_FOR_NO_WSP_CHECK()
+      for (int64_t i = 0; i < batchSize; ++i) {
+        PARALLEL_START_INTERRUPT_REGION
+        this->loadEventsFromSubBoxesConcurrently(leafBoxes[batchStart + i]);
+        PARALLEL_END_INTERRUPT_REGION
+      }
+      PARALLEL_CHECK_INTERRUPT_REGION
+    } else {
+      for (size_t ib = batchStart; ib < batchEnd; ++ib)
+        this->loadEventsFromSubBoxes(leafBoxes[ib]);
+    }
+
+    for (size_t ib = batchStart; ib < batchEnd; ++ib) {
+      auto box = leafBoxes[ib];
+      // data position has been already pre-calculated
+      if (fileBacked && box->getDataInMemorySize() > 0) {
+        box->getISaveable()->save();
+        box->clearDataFromMemory();
+      }
+      m_progress->report("Loading and merging box data");
+    }
+    batchStart = batchEnd;
+  }
+}
+
 //----------------------------------------------------------------------------------------------
 /** Perform the merging, but clone the initial workspace and use the same
  *splitting
@@ -187,9 +288,6 @@ void MergeMDFiles::doExecByCloning(const Mantid::API::IMDEventWorkspace_sptr &ws
   m_OutIWS = ws;
   m_MDEventType = ws->getEventTypeName();
 
-  // Run the tasks in parallel? TODO: enable
-  // bool Parallel = this->getProperty("Parallel");
-
   // Fix the box controller settings in the output workspace so that it splits
   // normally
   BoxController_sptr bc = ws->getBoxController();
@@ -220,19 +318,12 @@ void MergeMDFiles::doExecByCloning(const Mantid::API::IMDEventWorkspace_sptr &ws
   this->loadBoxData();
 
   size_t numBoxes = m_BoxStruct.getNBoxes();
-  // Progress report based on events processed.
-  m_progress = std::make_unique<Progress>(this, 0.1, 0.9, size_t(numBoxes));
-  m_progress->setNotifyStep(0.1);
 
   // For tracking progress
   // uint64_t m_totalEventsInTasks = 0;
 
-  // Prepare thread pool
   CPUTimer overallTime;
 
-  auto ts = new ThreadSchedulerFIFO();
-  ThreadPool tp(ts);
-
   Kernel::DiskBuffer *DiskBuf(nullptr);
   if (m_fileBasedTargetWS) {
     DiskBuf = bc->getFileIO();
@@ -240,48 +331,24 @@ void MergeMDFiles::doExecByCloning(const Mantid::API::IMDEventWorkspace_sptr &ws
 
   this->m_totalLoaded = 0;
   const std::vector<API::IMDNode *> &boxes = m_BoxStruct.getBoxes();
+  // Only the leaf boxes receive events. They are kept in the order of their
+  // pre-calculated positions in the target file, so the output is streamed.
+  std::vector<API::IMDNode *> leafBoxes;
+  leafBoxes.reserve(numBoxes);
+  std::copy_if(boxes.cbegin(), boxes.cend(), std::back_inserter(leafBoxes),
+               [](const API::IMDNode *box) { return box->isBox(); });
+
+  // Progress report based on boxes processed.
+  m_progress = std::make_unique<Progress>(this, 0.1, 0.9, leafBoxes.size());
+  m_progress->setNotifyStep(0.1);
 
-  for (size_t ib = 0; ib < numBoxes; ib++) {
-    auto box = boxes[ib];
-    if (!box->isBox())
-      continue;
-    // load all contributed events into current box;
-    this->loadEventsFromSubBoxes(box);
+  const bool parallel = getProperty("Parallel");
+  this->loadAndSaveBoxes(leafBoxes, parallel);
 
-    if (DiskBuf) {
-      if (box->getDataInMemorySize() > 0) { // data position has been already pre-calculated
-        box->getISaveable()->save();
-        box->clearDataFromMemory();
-        // Kernel::ISaveable *Saver = box->getISaveable();
-        // DiskBuf->toWrite(Saver);
-      }
-    }
-    // else
-    //{   size_t ID = box->getID();
-    //    uint64_t filePosition = targetEventIndexes[2*ID];
-    //    box->saveAt(saver.get(), filePosition);
-    //}
-    //
-    // if (!Parallel)
-    //{
-    //  // Run the task serially only
-    //  task->run();
-    //  delete task;
-    //}
-    // else
-    //{
-    //  // Enqueue to run in parallel (at the joinAll() call below).
-    //  ts->push(task);
-    //}
-
-    m_progress->reportIncrement(ib, "Loading and merging box data");
-  }
   if (DiskBuf) {
     DiskBuf->flushCache();
     bc->getFileIO()->flushData();
   }
-  //// Run any final tasks
-  // tp.joinAll();
   g_log.information() << overallTime << " to do all the adding.\n";
 
   // Close any open file handle
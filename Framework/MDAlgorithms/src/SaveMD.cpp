@@ -68,6 +68,11 @@ void SaveMD::init() {
                   "This saves it to a file AND makes the workspace into a "
                   "file-backed one.");
   setPropertySettings("MakeFileBacked", std::make_unique<EnabledWhenProperty>("UpdateFileBackEnd", IS_EQUAL_TO, "0"));
+  declareProperty("CompressEventData", false,
+                  "Only for MDEventWorkspaces saved to a new file: compress the events with\n"
+                  "byte-shuffle and deflate. The file is smaller but takes longer to write.");
+  setPropertySettings("CompressEventData",
+                      std::make_unique<EnabledWhenProperty>("UpdateFileBackEnd", IS_EQUAL_TO, "0"));
 }
 
 //----------------------------------------------------------------------------------------------
@@ -141,8 +146,9 @@ template <typename MDE, size_t nd> void SaveMD::doSaveEvents(typename MDEventWor
     // the boxes file positions are unknown and we need to calculate it.
     BoxFlatStruct.initFlatStructure(ws, filename);
     // create saver class
-    auto Saver = std::shared_ptr<API::IBoxControllerIO>(new DataObjects::BoxControllerNeXusIO(bc.get()));
+    auto Saver = std::make_shared<DataObjects::BoxControllerNeXusIO>(bc.get());
     Saver->setDataType(sizeof(coord_t), MDE::getTypeName());
+    Saver->setCompressEventData(getProperty("CompressEventData"));
     if (makeFileBackend) {
       // store saver with box controller
       bc->setFileBacked(Saver, filename);
@@ -63,6 +63,11 @@ void SaveMD2::init() {
   declareProperty("SaveInstrument", true, "Option to not save the instrument in the file. Only for MDHisto");
   declareProperty("SaveSample", true, "Option to not save the sample in the file. Only for MDHisto");
   declareProperty("SaveLogs", true, "Option to not save the logs in the file. Only for MDHisto");
+  declareProperty("CompressEventData", false,
+                  "Only for MDEventWorkspaces saved to a new file: compress the events with\n"
+                  "byte-shuffle and deflate. The file is smaller but takes longer to write.");
+  setPropertySettings("CompressEventData",
+                      std::make_unique<EnabledWhenProperty>("UpdateFileBackEnd", IS_EQUAL_TO, "0"));
 }
 
 //----------------------------------------------------------------------------------------------
@@ -200,6 +205,7 @@ void SaveMD2::exec() {
     saveMDv1->setProperty<std::string>("Filename", getProperty("Filename"));
     saveMDv1->setProperty<bool>("UpdateFileBackEnd", getProperty("UpdateFileBackEnd"));
     saveMDv1->setProperty<bool>("MakeFileBacked", getProperty("MakeFileBacked"));
+    saveMDv1->setProperty<bool>("CompressEventData", getProperty("CompressEventData"));
     saveMDv1->execute();
   } else if (histoWS) {
     this->doSaveHisto(histoWS);
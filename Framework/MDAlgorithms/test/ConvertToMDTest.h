@@ -480,6 +480,46 @@ public:
     }
   }
 
+  void test_indexed_conversion_appends_to_existing_workspace() {
+    auto sample_alg = AlgorithmManager::Instance().createUnmanaged("CreateSampleWorkspace");
+    sample_alg->initialize();
+    sample_alg->setChild(true);
+    sample_alg->setProperty("WorkspaceType", "Event");
+    sample_alg->setProperty("Function", "Flat background");
+    sample_alg->setProperty("NumEvents", 100);
+    sample_alg->setProperty("BankPixelWidth", 4);
+    sample_alg->setProperty("Random", false);
+    sample_alg->setPropertyValue("OutputWorkspace", "dummy");
+    sample_alg->execute();
+    MatrixWorkspace_sptr event_ws = sample_alg->getProperty("OutputWorkspace");
+
+    auto convert = [&event_ws](bool overwrite) {
+      auto convert_alg = AlgorithmManager::Instance().createUnmanaged("ConvertToMD");
+      convert_alg->initialize();
+      convert_alg->setRethrows(true);
+      convert_alg->setProperty("InputWorkspace", event_ws);
+      convert_alg->setPropertyValue("OutputWorkspace", "ConvertToMDTest_indexed_append");
+      convert_alg->setProperty("QDimensions", "Q3D");
+      convert_alg->setProperty("dEAnalysisMode", "Elastic");
+      convert_alg->setProperty("Q3DFrames", "Q_lab");
+      convert_alg->setPropertyValue("MinValues", "-50,-50,-50");
+      convert_alg->setPropertyValue("MaxValues", "50,50,50");
+      convert_alg->setPropertyValue("SplitInto", "2");
+      convert_alg->setProperty("SplitThreshold", 10);
+      convert_alg->setProperty("ConverterType", "Indexed");
+      convert_alg->setProperty("OverwriteExisting", overwrite);
+      TS_ASSERT_THROWS_NOTHING(convert_alg->execute());
+      return AnalysisDataService::Instance().retrieveWS<IMDEventWorkspace>("ConvertToMDTest_indexed_append");
+    };
+
+    const uint64_t numPoints = convert(true)->getNPoints();
+    TS_ASSERT_LESS_THAN(0, numPoints);
+    TSM_ASSERT_EQUALS("Indexed conversion must keep the events already in the workspace", convert(false)->getNPoints(),
+                      2 * numPoints);
+
+    AnalysisDataService::Instance().remove("ConvertToMDTest_indexed_append");
+  }
+
 private:
   void checkHistogramsHaveBeenStored(const std::string &wsName, double val = 0.34, double bin_min = 0.3,
                                      double bin_max = 0.4) {
@@ -537,6 +537,71 @@ public:
                          peakWS->getPeak(0).getIntensity(), 1500);
   }
 
+  //-------------------------------------------------------------------------------
+  void test_exec_many_overlapping_spheres() {
+    createMDEW();
+    addPeak(2000, 0., 0., 0., 3.0);
+    addPeak(1000, 2., 2., 2., 1.0);
+    addUniform(2000, {{-10., 10.}, {-10., 10.}, {-10., 10.}});
+
+    MDEventWorkspace3Lean::sptr mdews =
+        AnalysisDataService::Instance().retrieveWS<MDEventWorkspace3Lean>("IntegratePeaksMD2Test_MDEWS");
+    mdews->setCoordinateSystem(Mantid::Kernel::HKL);
+
+    // A grid of peaks whose spheres and background shells overlap each other
+    Instrument_sptr inst = ComponentCreationHelper::createTestInstrumentCylindrical(5);
+    PeaksWorkspace_sptr peakWS = std::make_shared<PeaksWorkspace>();
+    std::vector<V3D> centers;
+    for (double x = -3.; x <= 3.; x += 1.5)
+      for (double y = -3.; y <= 3.; y += 1.5)
+        for (double z = -3.; z <= 3.; z += 1.5)
+          centers.emplace_back(x, y, z);
+    for (const auto &center : centers)
+      peakWS->addPeak(Peak(inst, 1, 1.0, center));
+    AnalysisDataService::Instance().addOrReplace("IntegratePeaksMD2Test_peaks", peakWS);
+
+    const double peakRadius = 1.2, innerRadius = 1.5, outerRadius = 2.0;
+    IntegratePeaksMD2 alg;
+    alg.initialize();
+    alg.setPropertyValue("InputWorkspace", "IntegratePeaksMD2Test_MDEWS");
+    alg.setProperty("PeakRadius", std::vector<double>{peakRadius});
+    alg.setProperty("BackgroundInnerRadius", std::vector<double>{innerRadius});
+    alg.setProperty("BackgroundOuterRadius", std::vector<double>{outerRadius});
+    alg.setProperty("UseOnePercentBackgroundCorrection", false);
+    alg.setProperty("MaskEdgeTubes", false);
+    alg.setPropertyValue("PeaksWorkspace", "IntegratePeaksMD2Test_peaks");
+    alg.setPropertyValue("OutputWorkspace", "IntegratePeaksMD2Test_peaks");
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    TS_ASSERT(alg.isExecuted());
+
+    // Compare with a brute force count over all the events
+    std::vector<IMDNode *> boxes;
+    mdews->getBox()->getBoxes(boxes, 1000, true);
+    const double shellScale = std::pow(peakRadius, 3) / (std::pow(outerRadius, 3) - std::pow(innerRadius, 3));
+    for (size_t i = 0; i < centers.size(); ++i) {
+      double peakCounts = 0., shellCounts = 0.;
+      for (auto *node : boxes) {
+        auto *box = dynamic_cast<MDBox<MDLeanEvent<3>, 3> *>(node);
+        for (const auto &event : box->getConstEvents()) {
+          float distSq = 0.f;
+          for (size_t d = 0; d < 3; ++d) {
+            const float dist = event.getCenter(d) - static_cast<float>(centers[i][d]);
+            distSq += dist * dist;
+          }
+          if (distSq < static_cast<float>(peakRadius * peakRadius))
+            peakCounts += event.getSignal();
+          if (distSq > static_cast<float>(innerRadius * innerRadius) &&
+              distSq < static_cast<float>(outerRadius * outerRadius))
+            shellCounts += event.getSignal();
+        }
+      }
+      TS_ASSERT_DELTA(peakWS->getPeak(static_cast<int>(i)).getIntensity(), peakCounts - shellScale * shellCounts, 1.0);
+    }
+
+    AnalysisDataService::Instance().remove("IntegratePeaksMD2Test_MDEWS");
+    AnalysisDataService::Instance().remove("IntegratePeaksMD2Test_peaks");
+  }
+
   //-------------------------------------------------------------------------------
   //// Tests of ellipsoidal integration
 
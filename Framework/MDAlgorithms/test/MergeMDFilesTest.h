@@ -32,7 +32,11 @@ public:
 
   void test_exec_fileBacked() { do_test_exec("MergeMDFilesTest_OutputWS.nxs"); }
 
-  void do_test_exec(const std::string &OutputFilename) {
+  void test_exec_parallel() { do_test_exec("", true); }
+
+  void test_exec_fileBacked_parallel() { do_test_exec("MergeMDFilesTest_OutputWS.nxs", true); }
+
+  void do_test_exec(const std::string &OutputFilename, const bool parallel = false) {
     if (OutputFilename != "") {
       if (std::filesystem::exists(OutputFilename))
         std::filesystem::remove(OutputFilename);
@@ -62,6 +66,7 @@ public:
     TS_ASSERT(alg.isInitialized())
     TS_ASSERT_THROWS_NOTHING(alg.setProperty("Filenames", filenames));
     TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("OutputFilename", OutputFilename));
+    TS_ASSERT_THROWS_NOTHING(alg.setProperty("Parallel", parallel));
     TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("OutputWorkspace", outWSName));
 
     // clean up possible rubbish from previous runs
@@ -308,6 +308,46 @@ public:
     }
   }
 
+  void test_CompressEventData_round_trip() {
+    const std::string inputWSName("SaveMD2Test_compressedWS");
+    MDEventsTestHelper::makeAnyMDEW<MDLeanEvent<2>, 2>(10, 0., 20., 3, inputWSName);
+
+    const std::string saveFilename = "SaveMD2Test_compressed.nxs";
+    SaveMD2 saveAlg;
+    TS_ASSERT_THROWS_NOTHING(saveAlg.initialize())
+    TS_ASSERT_THROWS_NOTHING(saveAlg.setPropertyValue("InputWorkspace", inputWSName));
+    TS_ASSERT_THROWS_NOTHING(saveAlg.setPropertyValue("Filename", saveFilename));
+    TS_ASSERT_THROWS_NOTHING(saveAlg.setProperty("CompressEventData", true));
+    saveAlg.execute();
+    TS_ASSERT(saveAlg.isExecuted());
+
+    const std::string loadedWSName("SaveMD2Test_compressedLoadedWS");
+    LoadMD loadAlg;
+    TS_ASSERT_THROWS_NOTHING(loadAlg.initialize())
+    TS_ASSERT_THROWS_NOTHING(loadAlg.setPropertyValue("Filename", saveFilename));
+    TS_ASSERT_THROWS_NOTHING(loadAlg.setProperty("FileBackEnd", false));
+    TS_ASSERT_THROWS_NOTHING(loadAlg.setPropertyValue("OutputWorkspace", loadedWSName));
+    TS_ASSERT_THROWS_NOTHING(loadAlg.execute(););
+    TS_ASSERT(loadAlg.isExecuted());
+
+    auto inputWS = AnalysisDataService::Instance().retrieveWS<MDEventWorkspace2Lean>(inputWSName);
+    MDEventWorkspace2Lean::sptr loadedWS;
+    TS_ASSERT_THROWS_NOTHING(loadedWS =
+                                 AnalysisDataService::Instance().retrieveWS<MDEventWorkspace2Lean>(loadedWSName));
+    TS_ASSERT(loadedWS);
+    if (loadedWS) {
+      TS_ASSERT_EQUALS(loadedWS->getNPoints(), inputWS->getNPoints());
+      TS_ASSERT_DELTA(loadedWS->getBox()->getSignal(), inputWS->getBox()->getSignal(), 1e-6);
+    }
+
+    AnalysisDataService::Instance().remove(inputWSName);
+    AnalysisDataService::Instance().remove(loadedWSName);
+    const std::string this_filename = saveAlg.getProperty("Filename");
+    if (std::filesystem::exists(this_filename)) {
+      std::filesystem::remove(this_filename);
+    }
+  }
+
   /** Run SaveMD with the MDHistoWorkspace */
   void doTestHisto(const MDHistoWorkspace_sptr &ws) {
     std::string filename = "SaveMD2TestHisto.nxs";
@@ -63,6 +63,11 @@ private:
   /// Convert units
   API::MatrixWorkspace_sptr convertUnits(API::MatrixWorkspace_sptr matrixws, const std::string &target);
 
+  /// Crop in time-of-flight and convert to d-spacing in a single pass over the events
+  API::MatrixWorkspace_sptr cropAndConvertToDspacing(const double tofmin, const double tofmax);
+  bool canFuseEventSteps(const bool hasMaskBinTable, const double compressTolerance, const double tofmin,
+                         const double tofmax, const bool hasWallClockTolerance, const bool applyLorentz);
+
   /// Filter out absorption resonances
   API::MatrixWorkspace_sptr filterResonances(API::MatrixWorkspace_sptr matrixws);
 
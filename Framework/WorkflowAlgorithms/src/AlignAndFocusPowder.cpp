@@ -15,17 +15,25 @@
 #include "MantidDataObjects/MaskWorkspace.h"
 #include "MantidDataObjects/OffsetsWorkspace.h"
 #include "MantidDataObjects/TableWorkspace.h"
+#include "MantidDataObjects/UnitConversionHelpers.h"
 #include "MantidDataObjects/Workspace2D.h"
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/ConfigService.h"
 #include "MantidKernel/DateTimeValidator.h"
+#include "MantidKernel/DeltaEMode.h"
 #include "MantidKernel/EnabledWhenProperty.h"
 #include "MantidKernel/EnumeratedString.h"
 #include "MantidKernel/InstrumentInfo.h"
 #include "MantidKernel/ListValidator.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/PropertyManager.h"
 #include "MantidKernel/PropertyManagerDataService.h"
+#include "MantidKernel/Unit.h"
+#include "MantidKernel/UnitFactory.h"
+
+#include <atomic>
+#include <limits>
 
 using Mantid::Geometry::Instrument_const_sptr;
 using namespace Mantid::Kernel;
@@ -77,6 +85,7 @@ const std::string POLAR("Polar");
 const std::string AZIMUTHAL("Azimuthal");
 const std::string PM_NAME("ReductionProperties");
 const std::string LORENTZ("LorentzCorrection");
+const std::string FUSE_EVENT_STEPS("FuseEventSteps");
 } // namespace PropertyNames
 
 void getTofRange(const MatrixWorkspace_const_sptr &wksp, double &tmin, double &tmax) {
@@ -211,6 +220,13 @@ void AlignAndFocusPowder::init() {
                   "Multiply each spectrum by "
                   "sin(theta) where theta is "
                   "half of the Bragg angle");
+  declareProperty(PropertyNames::FUSE_EVENT_STEPS, false,
+                  "Crop the events in time-of-flight and convert them to d-spacing in a single pass "
+                  "over each spectrum. This is only done for event workspaces binned in d-spacing with "
+                  "explicit Params, and when none of the steps in between (RemovePromptPulseWidth, "
+                  "MaskBinTable, compressing the unfocussed events) or before rebinning (resonance "
+                  "filtering, LorentzCorrection, wavelength cropping) are requested. Otherwise the "
+                  "individual algorithms are run.");
   declareProperty("CropWavelengthMin", 0., "Crop the data at this minimum wavelength.");
   mapPropertyName(PropertyNames::WL_MIN, "wavelength_min");
   declareProperty("CropWavelengthMax", EMPTY_DBL(),
@@ -442,10 +458,11 @@ void AlignAndFocusPowder::exec() {
   double tofmax = EMPTY_DBL();
 
   // crop the workspace in time-of-flight
+  API::IAlgorithm_sptr cropAlg;
   if (((!isEmpty(xmin)) && (xmin >= 0.)) || ((!isEmpty(xmax)) && (xmax > 0.))) {
     getTofRange(m_outputW, tofmin, tofmax);
 
-    API::IAlgorithm_sptr cropAlg = createChildAlgorithm("CropWorkspace");
+    cropAlg = createChildAlgorithm("CropWorkspace");
     cropAlg->setProperty("InputWorkspace", m_outputW);
     cropAlg->setProperty("OutputWorkspace", m_outputW);
     bool setxmin = false;
@@ -461,12 +478,18 @@ void AlignAndFocusPowder::exec() {
       setxmax = true;
     }
     // only run if either xmin or xmax was set
-    if (setxmin || setxmax) {
-      g_log.information() << "running CropWorkspace(TOFmin=" << xmin << ", TOFmax=" << xmax << ") started at "
-                          << Types::Core::DateAndTime::getCurrentTime() << "\n";
-      cropAlg->executeAsChildAlg();
-      m_outputW = cropAlg->getProperty("OutputWorkspace");
-    }
+    if (!(setxmin || setxmax))
+      cropAlg.reset();
+  }
+
+  // the crop is done together with the conversion to d-spacing if possible
+  const bool fuseEventSteps = canFuseEventSteps(maskBinTableWS != nullptr, compressEventsTolerance, tofmin, tofmax,
+                                                !isEmpty(wallClockTolerance), applyLorentz);
+  if (cropAlg && !fuseEventSteps) {
+    g_log.information() << "running CropWorkspace(TOFmin=" << xmin << ", TOFmax=" << xmax << ") started at "
+                        << Types::Core::DateAndTime::getCurrentTime() << "\n";
+    cropAlg->executeAsChildAlg();
+    m_outputW = cropAlg->getProperty("OutputWorkspace");
   }
   m_progress->report();
 
@@ -535,7 +558,10 @@ void AlignAndFocusPowder::exec() {
 
   m_progress->report();
 
-  m_outputW = convertUnits(m_outputW, "dSpacing");
+  if (fuseEventSteps)
+    m_outputW = cropAndConvertToDspacing(tofmin, tofmax);
+  else
+    m_outputW = convertUnits(m_outputW, "dSpacing");
   m_progress->report();
 
   if (m_calibrationWS) {
@@ -773,6 +799,87 @@ API::MatrixWorkspace_sptr AlignAndFocusPowder::convertUnits(API::MatrixWorkspace
   return matrixws;
 }
 
+//----------------------------------------------------------------------------------------------
+/** Crop the events in time-of-flight and convert them to d-spacing in one pass over each spectrum.
+ * The result is the same as running CropWorkspace followed by ConvertUnits, except for the x-axis,
+ * which is converted without being cropped first. This is only called when the x-axis is replaced
+ * by rebinning before anything looks at it.
+ * @param tofmin :: lowest time-of-flight to keep, EMPTY_DBL() to keep everything
+ * @param tofmax :: highest time-of-flight to keep, EMPTY_DBL() to keep everything
+ */
+API::MatrixWorkspace_sptr AlignAndFocusPowder::cropAndConvertToDspacing(const double tofmin, const double tofmax) {
+  g_log.information() << "running fused CropWorkspace(TOFmin=" << xmin << ", TOFmax=" << xmax
+                      << ") and ConvertUnits(Target=dSpacing) started at " << Types::Core::DateAndTime::getCurrentTime()
+                      << "\n";
+
+  auto eventWS = std::dynamic_pointer_cast<EventWorkspace>(m_outputW);
+  const double lowerTof = isEmpty(tofmin) ? std::numeric_limits<double>::lowest() : tofmin;
+  const double upperTof = isEmpty(tofmax) ? std::numeric_limits<double>::max() : tofmax;
+
+  const Kernel::Unit_const_sptr fromUnit = m_outputW->getAxis(0)->unit();
+  const Kernel::Unit_const_sptr outputUnit = UnitFactory::Instance().create("dSpacing");
+  const bool signedTheta = UnitConversionHelpers::useSignedTheta(*m_outputW);
+
+  auto &spectrumInfo = m_outputW->mutableSpectrumInfo();
+  const double l1 = spectrumInfo.l1();
+  const auto numberOfSpectra = static_cast<int64_t>(m_outputW->getNumberHistograms());
+  std::atomic<int> failedDetectorCount{0};
+
+  PARALLEL_FOR_IF(Kernel::threadSafe(*eventWS))
+  for (int64_t i = 0; i < numberOfSpectra; ++i) {
+    PARALLEL_START_INTERRUPT_REGION
+    auto &events = eventWS->getSpectrum(i);
+    if (!events.empty())
+      events.cropTof(lowerTof, upperTof);
+    if (!UnitConversionHelpers::convertSpectrumViaTOF(*eventWS, spectrumInfo, i, *fromUnit, *outputUnit, l1,
+                                                      DeltaEMode::Elastic, signedTheta))
+      failedDetectorCount++;
+    PARALLEL_END_INTERRUPT_REGION
+  }
+  PARALLEL_CHECK_INTERRUPT_REGION
+
+  if (failedDetectorCount != 0) {
+    g_log.warning() << "Unable to calculate sample-detector distance for " << failedDetectorCount
+                    << " spectra. Masking spectrum.\n";
+  }
+  eventWS->clearMRU();
+  eventWS->getAxis(0)->unit() = outputUnit;
+
+  return m_outputW;
+}
+
+/** Whether the crop in time-of-flight and the conversion to d-spacing can be done by
+ * cropAndConvertToDspacing. None of the steps that run in between may be requested, and
+ * the x-axis must be replaced by Rebin before anything else looks at it.
+ */
+bool AlignAndFocusPowder::canFuseEventSteps(const bool hasMaskBinTable, const double compressTolerance,
+                                            const double tofmin, const double tofmax, const bool hasWallClockTolerance,
+                                            const bool applyLorentz) {
+  const bool fuseEventSteps = getProperty(PropertyNames::FUSE_EVENT_STEPS);
+  if (!fuseEventSteps)
+    return false;
+  if (!std::dynamic_pointer_cast<const EventWorkspace>(m_outputW) ||
+      m_outputW->getAxis(0)->unit()->unitID() != "TOF")
+    return false;
+
+  // steps between the crop and the conversion
+  const double removePromptPulseWidth = getProperty(PropertyNames::REMOVE_PROMPT_PULSE);
+  if (removePromptPulseWidth > 0. || hasMaskBinTable || !binInDspace)
+    return false;
+  // the decision to compress is normally made after cropping, with fewer events, so only
+  // fuse if compressing would not be worthwhile for all of the events
+  if (shouldCompressUnfocused(compressTolerance, tofmin, tofmax, hasWallClockTolerance)) {
+    g_log.information("Not fusing the event steps as the unfocussed events may be compressed");
+    return false;
+  }
+
+  // steps that use the x-axis before it is replaced by the d-spacing binning
+  if (!m_resonanceLower.empty() || applyLorentz || minwl > 0. || !isEmpty(maxwl))
+    return false;
+  return m_resampleX == 0 && m_delta_ragged.empty() && m_params.size() >= 3 &&
+         std::none_of(m_params.cbegin(), m_params.cend(), [](const double param) { return isEmpty(param); });
+}
+
 API::MatrixWorkspace_sptr AlignAndFocusPowder::filterResonances(API::MatrixWorkspace_sptr matrixws) {
   // determine the previous units
   const std::string PREVIOUS_UNITS(matrixws->getAxis(0)->unit()->unitID());
@@ -9,6 +9,7 @@
 #include "MantidFrameworkTestHelpers/WorkspaceCreationHelper.h"
 #include <cxxtest/TestSuite.h>
 
+#include "MantidAPI/AlgorithmManager.h"
 #include "MantidAPI/Axis.h"
 #include "MantidAPI/FrameworkManager.h"
 #include "MantidAPI/TableRow.h"
@@ -664,6 +665,47 @@ public:
     AnalysisDataService::Instance().remove(m_outputWS);
   }
 
+  void testEventWksp_fuseEventSteps() {
+    // Setup the event workspace
+    setUp_EventWorkspace("EventWksp_fuseEventSteps");
+    groupAllBanks(m_inputWS);
+
+    // focus the same data with and without the fused crop and conversion
+    const std::string classicWS{"EventWksp_fuseEventSteps_classic"};
+    const std::string fusedWS{"EventWksp_fuseEventSteps_fused"};
+    for (const auto &[outputWS, fuseEventSteps] : {std::make_pair(classicWS, false), std::make_pair(fusedWS, true)}) {
+      AlignAndFocusPowder align_and_focus;
+      align_and_focus.initialize();
+      align_and_focus.setPropertyValue("InputWorkspace", m_inputWS);
+      align_and_focus.setPropertyValue("OutputWorkspace", outputWS);
+      align_and_focus.setPropertyValue("GroupingWorkspace", m_groupWS);
+      align_and_focus.setProperty("Dspacing", true);
+      align_and_focus.setPropertyValue("Params", "0.1,-0.001,10.");
+      align_and_focus.setPropertyValue("TMin", "2000.0");
+      align_and_focus.setPropertyValue("TMax", "12000.0");
+      align_and_focus.setProperty("PreserveEvents", true);
+      align_and_focus.setProperty("FuseEventSteps", fuseEventSteps);
+      TS_ASSERT_THROWS_NOTHING(align_and_focus.execute());
+      TS_ASSERT(align_and_focus.isExecuted());
+    }
+
+    const auto classic = AnalysisDataService::Instance().retrieveWS<EventWorkspace>(classicWS);
+    const auto fused = AnalysisDataService::Instance().retrieveWS<EventWorkspace>(fusedWS);
+    TS_ASSERT_LESS_THAN(0, fused->getNumberEvents());
+    TS_ASSERT_EQUALS(fused->getNumberEvents(), classic->getNumberEvents());
+
+    auto checkAlg = AlgorithmManager::Instance().create("CompareWorkspaces");
+    checkAlg->setPropertyValue("Workspace1", classicWS);
+    checkAlg->setPropertyValue("Workspace2", fusedWS);
+    checkAlg->execute();
+    TS_ASSERT(checkAlg->getProperty("Result"));
+
+    AnalysisDataService::Instance().remove(m_inputWS);
+    AnalysisDataService::Instance().remove(m_groupWS);
+    AnalysisDataService::Instance().remove(classicWS);
+    AnalysisDataService::Instance().remove(fusedWS);
+  }
+
   /** Setup for testing HRPD NeXus data */
   void setUp_HRP38692() {
 